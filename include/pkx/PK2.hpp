@@ -32,7 +32,7 @@
 
 namespace pksm
 {
-    class PK2 : public PKX
+    class PK2 final : public PKX
     {
     private:
         u8* shiftedData;
@@ -75,6 +75,7 @@ namespace pksm
         static constexpr Species FORMAT_SPECIES_LIMIT = Species::Celebi;
 
         PK2(PrivateConstructor, u8* dt, bool japanese = false, bool directAccess = false);
+        PK2(ViewConstructor, u8* dt, bool japanese) : PK2(PrivateConstructor{}, dt, japanese, true) {}
 
         [[nodiscard]] std::string_view extension() const override { return ".pk2"; }
 
@@ -86,8 +87,14 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK7> convertToG7(Sav& save) const override;
         // [[nodiscard]] std::unique_ptr<PB7> convertToLGPE(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK8> convertToG8(Sav& save) const override;
+        // Same as the newer-generation conversions above, but write the box data into out,
+        // which must hold the target's BOX_LENGTH bytes. Intermediate generations are
+        // converted in stack buffers rather than allocated
+        void convertToG7(Sav& save, u8* out) const;
+        void convertToG8(Sav& save, u8* out) const;
 
         [[nodiscard]] std::unique_ptr<PKX> clone(void) const override;
+        using PKX::clone;
 
         [[nodiscard]] Generation generation(void) const override { return Generation::TWO; }
 
@@ -32,7 +32,7 @@
 
 namespace pksm
 {
-    class PK3 : public PKX
+    class PK3 final : public PKX
     {
     protected:
         static constexpr size_t BlockDataLength   = 12;
@@ -75,6 +75,10 @@ namespace pksm
         static constexpr Species FORMAT_SPECIES_LIMIT = Species::Deoxys;
 
         PK3(PrivateConstructor, u8* dt, bool party = false, bool directAccess = false);
+        PK3(ViewConstructor, u8* dt, bool party)
+            : PKX(dt, party ? PARTY_LENGTH : BOX_LENGTH, true)
+        {
+        }
 
         [[nodiscard]] std::string_view extension() const override { return ".pk3"; }
 
@@ -88,8 +92,17 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK7> convertToG7(Sav& save) const override;
         // std::unique_ptr<PB7> convertToLGPE(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK8> convertToG8(Sav& save) const override;
+        // Same as the newer-generation conversions above, but write the box data into out,
+        // which must hold the target's BOX_LENGTH bytes. Intermediate generations are
+        // converted in stack buffers rather than allocated
+        void convertToG4(Sav& save, u8* out) const;
+        void convertToG5(Sav& save, u8* out) const;
+        void convertToG6(Sav& save, u8* out) const;
+        void convertToG7(Sav& save, u8* out) const;
+        void convertToG8(Sav& save, u8* out) const;
 
         [[nodiscard]] std::unique_ptr<PKX> clone(void) const override;
+        using PKX::clone;
 
         [[nodiscard]] Generation generation(void) const override;
 
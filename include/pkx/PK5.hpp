@@ -32,7 +32,7 @@
 
 namespace pksm
 {
-    class PK5 : public PKX
+    class PK5 final : public PKX
     {
     private:
         static constexpr size_t BLOCK_LENGTH     = 32;
@@ -56,6 +56,10 @@ namespace pksm
         static constexpr Species FORMAT_SPECIES_LIMIT = Species::Genesect;
 
         PK5(PrivateConstructor, u8* dt, bool party = false, bool directAccess = false);
+        PK5(ViewConstructor, u8* dt, bool party)
+            : PKX(dt, party ? PARTY_LENGTH : BOX_LENGTH, true)
+        {
+        }
 
         [[nodiscard]] std::string_view extension() const override { return ".pk5"; }
 
@@ -67,13 +71,24 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK7> convertToG7(Sav& save) const override;
         // std::unique_ptr<PB7> convertToLGPE(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK8> convertToG8(Sav& save) const override;
+        // Same as the newer-generation conversions above, but write the box data into out,
+        // which must hold the target's BOX_LENGTH bytes. Intermediate generations are
+        // converted in stack buffers rather than allocated
+        void convertToG6(Sav& save, u8* out) const;
+        void convertToG7(Sav& save, u8* out) const;
+        void convertToG8(Sav& save, u8* out) const;
 
         [[nodiscard]] std::unique_ptr<PKX> clone(void) const override;
+        using PKX::clone;
 
         [[nodiscard]] Generation generation(void) const override;
         void decrypt(void) override;
         void encrypt(void) override;
         [[nodiscard]] bool isEncrypted(void) const override;
+        // Same as the above, but on raw slot data that isn't wrapped in a PKX
+        static void decrypt(u8* dt, bool party);
+        static void encrypt(u8* dt, bool party);
+        [[nodiscard]] static bool isEncrypted(const u8* dt);
 
         [[nodiscard]] bool isParty(void) const override { return getLength() == PARTY_LENGTH; }
 
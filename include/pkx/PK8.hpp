@@ -32,7 +32,7 @@
 
 namespace pksm
 {
-    class PK8 : public PKX
+    class PK8 final : public PKX
     {
     private:
         static constexpr size_t BLOCK_LENGTH     = 80;
@@ -59,6 +59,10 @@ namespace pksm
         static constexpr Species FORMAT_SPECIES_LIMIT = Species::Zarude;
 
         PK8(PrivateConstructor, u8* dt, bool party = false, bool directAccess = false);
+        PK8(ViewConstructor, u8* dt, bool party)
+            : PKX(dt, party ? PARTY_LENGTH : BOX_LENGTH, true)
+        {
+        }
 
         [[nodiscard]] std::string_view extension() const override { return ".pk8"; }
 
@@ -72,11 +76,16 @@ namespace pksm
         // std::unique_ptr<PB7> convertToLGPE(Sav& save) const override;
 
         [[nodiscard]] std::unique_ptr<PKX> clone(void) const override;
+        using PKX::clone;
 
         [[nodiscard]] Generation generation(void) const override;
         void decrypt(void) override;
         void encrypt(void) override;
         [[nodiscard]] bool isEncrypted(void) const override;
+        // Same as the above, but on raw slot data that isn't wrapped in a PKX
+        static void decrypt(u8* dt, bool party);
+        static void encrypt(u8* dt, bool party);
+        [[nodiscard]] static bool isEncrypted(const u8* dt);
 
         [[nodiscard]] bool isParty(void) const override { return getLength() == PARTY_LENGTH; }
 
@@ -0,0 +1,117 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62, Pk11
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef PKVARIANT_HPP
+#define PKVARIANT_HPP
+
+#include "pkx/PB7.hpp"
+#include "pkx/PK1.hpp"
+#include "pkx/PK2.hpp"
+#include "pkx/PK3.hpp"
+#include "pkx/PK4.hpp"
+#include "pkx/PK5.hpp"
+#include "pkx/PK6.hpp"
+#include "pkx/PK7.hpp"
+#include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
+#include "utils/coretypes.h"
+#include <optional>
+#include <utility>
+#include <variant>
+
+namespace pksm
+{
+    // Closed set of slot views. std::visit on one of these instantiates the visitor once per
+    // concrete format, so everything it calls on the view is resolved statically
+    using PKVariant      = std::variant<PKView<PK1>, PKView<PK2>, PKView<PK3>, PKView<PK4>,
+        PKView<PK5>, PKView<PK6>, PKView<PK7>, PKView<PB7>, PKView<PK8>>;
+    using ConstPKVariant = std::variant<ConstPKView<PK1>, ConstPKView<PK2>, ConstPKView<PK3>,
+        ConstPKView<PK4>, ConstPKView<PK5>, ConstPKView<PK6>, ConstPKView<PK7>, ConstPKView<PB7>,
+        ConstPKView<PK8>>;
+
+    // Views data as gen's format. party means Japanese for Gen I/II, as it does for getPKM.
+    // Empty for Generation::UNUSED
+    [[nodiscard]] std::optional<PKVariant> makePKVariant(
+        Generation gen, u8* data, bool party = false);
+    [[nodiscard]] std::optional<ConstPKVariant> makeConstPKVariant(
+        Generation gen, const u8* data, bool party = false);
+
+    // Calls func with pk cast to its concrete type, so a generic func is instantiated per format
+    // and resolves its calls statically
+    template <typename Func>
+    decltype(auto) visit(Func&& func, PKX& pk)
+    {
+        switch (pk.generation())
+        {
+            case Generation::ONE:
+                return std::forward<Func>(func)(static_cast<PK1&>(pk));
+            case Generation::TWO:
+                return std::forward<Func>(func)(static_cast<PK2&>(pk));
+            case Generation::THREE:
+                return std::forward<Func>(func)(static_cast<PK3&>(pk));
+            case Generation::FOUR:
+                return std::forward<Func>(func)(static_cast<PK4&>(pk));
+            case Generation::FIVE:
+                return std::forward<Func>(func)(static_cast<PK5&>(pk));
+            case Generation::SIX:
+                return std::forward<Func>(func)(static_cast<PK6&>(pk));
+            case Generation::SEVEN:
+                return std::forward<Func>(func)(static_cast<PK7&>(pk));
+            case Generation::LGPE:
+                return std::forward<Func>(func)(static_cast<PB7&>(pk));
+            default: // No PKX reports UNUSED
+                return std::forward<Func>(func)(static_cast<PK8&>(pk));
+        }
+    }
+
+    template <typename Func>
+    decltype(auto) visit(Func&& func, const PKX& pk)
+    {
+        switch (pk.generation())
+        {
+            case Generation::ONE:
+                return std::forward<Func>(func)(static_cast<const PK1&>(pk));
+            case Generation::TWO:
+                return std::forward<Func>(func)(static_cast<const PK2&>(pk));
+            case Generation::THREE:
+                return std::forward<Func>(func)(static_cast<const PK3&>(pk));
+            case Generation::FOUR:
+                return std::forward<Func>(func)(static_cast<const PK4&>(pk));
+            case Generation::FIVE:
+                return std::forward<Func>(func)(static_cast<const PK5&>(pk));
+            case Generation::SIX:
+                return std::forward<Func>(func)(static_cast<const PK6&>(pk));
+            case Generation::SEVEN:
+                return std::forward<Func>(func)(static_cast<const PK7&>(pk));
+            case Generation::LGPE:
+                return std::forward<Func>(func)(static_cast<const PB7&>(pk));
+            default: // No PKX reports UNUSED
+                return std::forward<Func>(func)(static_cast<const PK8&>(pk));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,118 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62, Pk11
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef PKVIEW_HPP
+#define PKVIEW_HPP
+
+#include "pkx/PKX.hpp"
+#include "utils/coretypes.h"
+#include "utils/genToPkx.hpp"
+#include <memory>
+#include <type_traits>
+
+namespace pksm
+{
+    namespace internal
+    {
+        // The flag a PkType's view constructor takes: Japanese for Gen I/II, party otherwise
+        template <typename PkType>
+        [[nodiscard]] bool viewFlag(const PkType& pk)
+        {
+            if constexpr (std::is_same_v<typename GenToPkx<Generation::ONE>::PKX, PkType> ||
+                          std::is_same_v<typename GenToPkx<Generation::TWO>::PKX, PkType>)
+            {
+                return pk.getLength() == PkType::JP_LENGTH_WITH_NAMES;
+            }
+            else
+            {
+                return pk.getLength() == PkType::PARTY_LENGTH;
+            }
+        }
+    }
+
+    // A PkType that reads and writes straight through to memory it doesn't own, such as a box
+    // slot in a save. The PkType is held by value, so making, copying or sorting views never
+    // allocates, and since every PkType is final, calls through the view are resolved statically.
+    // The slot must already be decrypted, as it is after Sav::cryptBoxData(true)
+    template <typename PkType>
+    class PKView
+    {
+    private:
+        PkType pk;
+
+    public:
+        explicit PKView(u8* data, bool party = false) : pk(PKX::ViewConstructor{}, data, party) {}
+        PKView(const PKView& other) : PKView(other.pk.data, internal::viewFlag(other.pk)) {}
+        PKView& operator=(const PKView& other)
+        {
+            u8* data  = other.pk.data;
+            bool flag = internal::viewFlag(other.pk);
+            std::destroy_at(&pk);
+            std::construct_at(&pk, PKX::ViewConstructor{}, data, flag);
+            return *this;
+        }
+
+        [[nodiscard]] PkType* operator->(void) { return &pk; }
+        [[nodiscard]] const PkType* operator->(void) const { return &pk; }
+        [[nodiscard]] PkType& operator*(void) { return pk; }
+        [[nodiscard]] const PkType& operator*(void) const { return pk; }
+    };
+
+    // Read-only counterpart of PKView
+    template <typename PkType>
+    class ConstPKView
+    {
+    private:
+        PkType pk;
+
+    public:
+        explicit ConstPKView(const u8* data, bool party = false)
+            : pk(PKX::ViewConstructor{}, const_cast<u8*>(data), party)
+        {
+        }
+        ConstPKView(const PKView<PkType>& view)
+            : ConstPKView(view->rawData().data(), internal::viewFlag(*view))
+        {
+        }
+        ConstPKView(const ConstPKView& other)
+            : ConstPKView(other.pk.data, internal::viewFlag(other.pk))
+        {
+        }
+        ConstPKView& operator=(const ConstPKView& other)
+        {
+            u8* data  = other.pk.data;
+            bool flag = internal::viewFlag(other.pk);
+            std::destroy_at(&pk);
+            std::construct_at(&pk, PKX::ViewConstructor{}, data, flag);
+            return *this;
+        }
+
+        [[nodiscard]] const PkType* operator->(void) const { return &pk; }
+        [[nodiscard]] const PkType& operator*(void) const { return pk; }
+    };
+}
+
+#endif
@@ -41,12 +41,17 @@
 #include "enums/Type.hpp"
 #include "pkx/IPKFilterable.hpp"
 #include "pkx/PKFilter.hpp"
+#include "pkx/PKXArena.hpp"
 #include "sav/Item.hpp"
 #include "utils/coretypes.h"
 #include "utils/DateTime.hpp"
 #include "utils/genToPkx.hpp"
+#include <algorithm>
+#include <array>
 #include <concepts>
 #include <memory>
+#include <new>
+#include <span>
 #include <string>
 
 namespace pksm
@@ -83,10 +88,19 @@ namespace pksm
         struct PrivateConstructor
         {
         };
+        // Wraps data in place without checking whether it needs decrypting. Used by PKView
+        struct ViewConstructor
+        {
+        };
+        template <typename PkType>
+        friend class PKView;
+        template <typename PkType>
+        friend class ConstPKView;
 
         PKX(u8* data, size_t length, bool directAccess = false);
 
         [[nodiscard]] u32 expTable(u8 row, u8 col) const;
+        [[nodiscard]] size_t partyLength(void) const;
         virtual void reorderMoves(void);
 
         u32 length = 0;
@@ -141,6 +155,71 @@ namespace pksm
             return nullptr;
         }
 
+        // Same as the above, but the object and a copy of data are both placed in arena. With
+        // null data, the new Pokemon's data is zeroed
+        [[nodiscard]] static PKXArena::Ptr<PKX> getPKM(
+            PKXArena& arena, Generation gen, u8* data, size_t length);
+
+        template <Generation::EnumType g>
+        [[nodiscard]] static PKXArena::Ptr<typename GenToPkx<g>::PKX> getPKM(
+            PKXArena& arena, u8* data, size_t length)
+        {
+            return getPKM<typename GenToPkx<g>::PKX>(arena, data, length);
+        }
+
+        template <std::derived_from<::pksm::PKX> Pkm>
+        [[nodiscard]] static PKXArena::Ptr<Pkm> getPKM(PKXArena& arena, u8* data, size_t length)
+        {
+            bool flag;
+            if constexpr (std::is_same_v<typename GenToPkx<Generation::ONE>::PKX,
+                              std::remove_cvref_t<Pkm>> ||
+                          std::is_same_v<typename GenToPkx<Generation::TWO>::PKX,
+                              std::remove_cvref_t<Pkm>>)
+            {
+                if (Pkm::JP_LENGTH_WITH_NAMES == length || Pkm::INT_LENGTH_WITH_NAMES == length)
+                {
+                    flag = length == Pkm::JP_LENGTH_WITH_NAMES;
+                }
+                else if (data == nullptr)
+                {
+                    flag   = false;
+                    length = Pkm::INT_LENGTH_WITH_NAMES;
+                }
+                else
+                {
+                    return nullptr;
+                }
+            }
+            else
+            {
+                if (Pkm::PARTY_LENGTH == length || Pkm::BOX_LENGTH == length)
+                {
+                    flag = length == Pkm::PARTY_LENGTH;
+                }
+                else if (data == nullptr)
+                {
+                    flag   = false;
+                    length = Pkm::BOX_LENGTH;
+                }
+                else
+                {
+                    return nullptr;
+                }
+            }
+
+            u8* copy = static_cast<u8*>(arena.allocate(length, alignof(u32)));
+            if (data)
+            {
+                std::copy(data, data + length, copy);
+            }
+            else
+            {
+                std::fill_n(copy, length, 0);
+            }
+            void* memory = arena.allocate(sizeof(Pkm), alignof(Pkm));
+            return PKXArena::Ptr<Pkm>(new (memory) Pkm(PrivateConstructor{}, copy, flag, true));
+        }
+
         [[nodiscard]] virtual ~PKX();
         PKX(const PKX& pk);
         PKX(PKX&& pk);
@@ -173,6 +252,8 @@ namespace pksm
         [[nodiscard]] virtual std::unique_ptr<PK8> convertToG8(Sav& save) const;
         [[nodiscard]] virtual std::unique_ptr<PKX> clone(void) const = 0;
         [[nodiscard]] std::unique_ptr<PKX> partyClone(void) const;
+        [[nodiscard]] PKXArena::Ptr<PKX> clone(PKXArena& arena) const;
+        [[nodiscard]] PKXArena::Ptr<PKX> partyClone(PKXArena& arena) const;
 
         [[nodiscard]] Generation generation(void) const override = 0;
         [[nodiscard]] bool originGen7(void) const;
@@ -189,6 +270,16 @@ namespace pksm
             GameVersion originGame, Nature nature, u8 form, u8 abilityNum, bool shiny, u16 tsv,
             u32 oldPid, Generation gen);
         [[nodiscard]] static Gender genderFromRatio(u32 pid, u8 gt);
+        // Level for an amount of experience on growth rate expType, as returned by level()
+        [[nodiscard]] static u8 levelFromExperience(u32 experience, u8 expType);
+        // Same as above for every element, out[i] taking the level of experience[i] and expTypes[i]
+        static void levelsFromExperience(
+            std::span<const u32> experience, std::span<const u8> expTypes, std::span<u8> out);
+        // Every stat of every Pokémon in pks, out[i][stat] being pks[i]->stat(stat). Their inputs
+        // are read in one pass and the formula then runs over each stat as a column
+        static void stats(std::span<const PKX* const> pks, std::span<std::array<u16, 6>> out);
+        // Same as calling updatePartyData on each of pks, with their stats computed as above
+        static void updatePartyData(std::span<PKX* const> pks);
 
         // BLOCK A
         [[nodiscard]] virtual u32 encryptionConstant(void) const = 0;
@@ -0,0 +1,77 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62, Pk11
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef PKXARENA_HPP
+#define PKXARENA_HPP
+
+#include "utils/coretypes.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace pksm
+{
+    // Bump allocator for batches of PKX objects, such as a loaded bank. The arena overloads of
+    // PKX::getPKM, clone and partyClone put both the object and its data in here, so a batch costs
+    // a handful of chunk allocations instead of two heap allocations per Pokemon
+    class PKXArena
+    {
+    public:
+        // Runs the destructor of an object in an arena, leaving its memory to the arena
+        struct Deleter
+        {
+            template <typename T>
+            void operator()(T* p) const
+            {
+                p->~T();
+            }
+        };
+        template <typename T>
+        using Ptr = std::unique_ptr<T, Deleter>;
+
+        explicit PKXArena(size_t chunkSize = 0x10000) : chunkSize(chunkSize) {}
+        PKXArena(const PKXArena&)            = delete;
+        PKXArena& operator=(const PKXArena&) = delete;
+
+        [[nodiscard]] void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+        // Frees everything allocated so far in one go, keeping the chunks around for the next
+        // batch. Every Ptr into the arena must have been destroyed first
+        void reset(void);
+
+    private:
+        struct Chunk
+        {
+            std::unique_ptr<u8[]> memory;
+            size_t size;
+        };
+        std::vector<Chunk> chunks;
+        size_t chunkSize;
+        size_t current = 0;
+        size_t used    = 0;
+    };
+}
+
+#endif
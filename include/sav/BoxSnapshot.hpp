@@ -0,0 +1,119 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62, Pk11
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef BOXSNAPSHOT_HPP
+#define BOXSNAPSHOT_HPP
+
+#include "enums/Ability.hpp"
+#include "enums/Ball.hpp"
+#include "enums/Move.hpp"
+#include "enums/Nature.hpp"
+#include "enums/Species.hpp"
+#include "enums/Stat.hpp"
+#include "utils/coretypes.h"
+#include <array>
+#include <span>
+#include <vector>
+
+namespace pksm
+{
+    class PKX;
+    class Sav;
+
+    // Structure-of-arrays copy of the commonly queried fields of every box and party slot in a
+    // save, decoded once through the usual PKX getters so that reports don't have to go through
+    // them per slot. Entry box * 30 + slot is a box slot, and the party follows the boxes.
+    // It doesn't follow the save by itself: refresh whatever was edited
+    class BoxSnapshot
+    {
+    public:
+        BoxSnapshot(void) = default;
+        explicit BoxSnapshot(const Sav& save) { refresh(save); }
+
+        // Decodes every slot again
+        void refresh(const Sav& save);
+        // Decodes one box slot again
+        void refresh(const Sav& save, u8 box, u8 slot);
+        // Decodes one party slot again, or the whole party if its size changed
+        void refreshParty(const Sav& save, u8 slot);
+
+        [[nodiscard]] size_t size(void) const { return speciesData.size(); }
+        [[nodiscard]] size_t boxSlots(void) const { return boxSlotCount; }
+        [[nodiscard]] size_t partySlots(void) const { return size() - boxSlotCount; }
+        [[nodiscard]] size_t index(u8 box, u8 slot) const { return box * 30 + slot; }
+        [[nodiscard]] size_t partyIndex(u8 slot) const { return boxSlotCount + slot; }
+
+        [[nodiscard]] std::span<const Species> species(void) const { return speciesData; }
+        [[nodiscard]] std::span<const u16> forms(void) const { return formData; }
+        [[nodiscard]] std::span<const u8> levels(void) const { return levelData; }
+        [[nodiscard]] std::span<const u32> experiences(void) const { return experienceData; }
+        [[nodiscard]] std::span<const u8> ivs(Stat stat) const { return ivData[size_t(stat)]; }
+        [[nodiscard]] std::span<const u16> evs(Stat stat) const { return evData[size_t(stat)]; }
+        [[nodiscard]] std::span<const Nature> natures(void) const { return natureData; }
+        [[nodiscard]] std::span<const Ability> abilities(void) const { return abilityData; }
+        [[nodiscard]] std::span<const Ball> balls(void) const { return ballData; }
+        // 1 for shiny, 0 otherwise
+        [[nodiscard]] std::span<const u8> shinies(void) const { return shinyData; }
+        [[nodiscard]] std::span<const u16> TSVs(void) const { return tsvData; }
+        [[nodiscard]] std::span<const Move> moves(u8 move) const { return moveData[move]; }
+        [[nodiscard]] std::span<const u16> heldItems(void) const { return heldItemData; }
+
+        [[nodiscard]] size_t count(Species species) const;
+        // Empty slots often decode as shiny, so they aren't counted
+        [[nodiscard]] size_t shinyCount(void) const;
+        [[nodiscard]] size_t heldItemCount(u16 item) const;
+        [[nodiscard]] size_t knowsMoveCount(Move move) const;
+        // Per entry sums over all six stats
+        [[nodiscard]] std::vector<u16> ivTotals(void) const;
+        [[nodiscard]] std::vector<u16> evTotals(void) const;
+        // Number of entries of each species, indexed by species. Empty slots count as Species::None
+        [[nodiscard]] std::vector<u32> speciesHistogram(void) const;
+
+    private:
+        void resize(size_t size);
+        void store(size_t index, const PKX& pk);
+        // Derives levels of stored entries [first, first + count) from their experience
+        void updateLevels(size_t first, size_t count);
+
+        size_t boxSlotCount = 0;
+        std::vector<Species> speciesData;
+        std::vector<u16> formData;
+        std::vector<u8> levelData;
+        std::vector<u32> experienceData;
+        std::vector<u8> expTypeData;
+        std::array<std::vector<u8>, 6> ivData;
+        std::array<std::vector<u16>, 6> evData;
+        std::vector<Nature> natureData;
+        std::vector<Ability> abilityData;
+        std::vector<Ball> ballData;
+        std::vector<u8> shinyData;
+        std::vector<u16> tsvData;
+        std::array<std::vector<Move>, 4> moveData;
+        std::vector<u16> heldItemData;
+    };
+}
+
+#endif
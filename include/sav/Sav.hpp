@@ -35,14 +35,18 @@
 #include "enums/Language.hpp"
 #include "enums/Species.hpp"
 #include "pkx/PKX.hpp"
+#include "sav/BoxSnapshot.hpp"
 #include "sav/Item.hpp"
 #include "utils/coretypes.h"
 #include "utils/DateTime.hpp"
+#include "utils/endian.hpp"
+#include "utils/parallel.hpp"
 #include "utils/VersionTables.hpp"
 #include "wcx/WCX.hpp"
 #include <map>
 #include <memory>
 #include <set>
+#include <span>
 #include <type_traits>
 #include <vector>
 
@@ -84,6 +88,62 @@ namespace pksm
         [[nodiscard]] static std::unique_ptr<Sav> checkDSType(const std::shared_ptr<u8[]>& dt);
         [[nodiscard]] static bool validSequence(const std::shared_ptr<u8[]>& dt, size_t offset);
 
+        // Whether any of [offset, offset + size) was marked dirty since the last clearDirty().
+        // Always true while changes aren't being tracked
+        [[nodiscard]] bool isDirty(u32 offset, u32 size) const;
+        // Called by finishEditing() once everything dirty has been resigned
+        void clearDirty(void);
+        // Encrypts a slot that cryptBoxData decrypted in place. Doing so restores the slot's
+        // original bytes unless its checksum was stale, so only then is it marked dirty
+        void encryptBoxSlot(PKX& pk, u32 offset, u32 size);
+        // cryptBoxData for formats whose boxes are 30 back to back slots of one PkType, done on
+        // the raw slots without PKX objects. Box n starts at boxes + n * boxStride, and whole boxes
+        // are spread over up to threads threads. Slots in data get encryptBoxSlot's dirty
+        // handling, which needs to run on a single thread
+        template <typename PkType>
+        void cryptBoxSlots(u8* boxes, u32 boxStride, size_t slots, bool party, bool crypted,
+            unsigned threads = 1)
+        {
+            const u32 slotLength = party ? PkType::PARTY_LENGTH : PkType::BOX_LENGTH;
+            const bool inData    = boxes >= data.get() && boxes < data.get() + length;
+            const bool track     = trackingChanges && !crypted && inData;
+            parallelFor((slots + 29) / 30, track ? 1 : threads,
+                [&](size_t box)
+                {
+                    const size_t count = std::min<size_t>(30, slots - box * 30);
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        u8* slot             = boxes + box * boxStride + i * slotLength;
+                        const bool decrypted = PkType::isEncrypted(slot);
+                        if (decrypted)
+                        {
+                            PkType::decrypt(slot, party);
+                        }
+                        if (!crypted)
+                        {
+                            // Decrypting and encrypting again only changes the slot if its
+                            // checksum was stale, or if it still looks encrypted afterwards
+                            const u16 oldChecksum = LittleEndian::convertTo<u16>(slot + 6);
+                            bool changed          = decrypted;
+                            if (!PkType::isEncrypted(slot))
+                            {
+                                PkType::encrypt(slot, party);
+                                changed = LittleEndian::convertTo<u16>(slot + 6) != oldChecksum;
+                            }
+                            if (track && changed)
+                            {
+                                markDirty(slot - data.get(), slotLength);
+                            }
+                        }
+                    }
+                });
+        }
+
+    private:
+        static constexpr u32 DIRTY_PAGE_SIZE = 0x100;
+        std::vector<bool> dirtyPages;
+        bool trackingChanges = false;
+
     public:
         enum class Pouch
         {
@@ -111,12 +171,29 @@ namespace pksm
             FORM,
             ABILITY,
             ITEM,
-            BALL
+            BALL,
+            CONVERSION // No conversion to the save's format exists
+        };
+        struct TransferOptions
+        {
+            // Passed on to pkm(pk, box, slot, applyTrade)
+            bool applyTrade = true;
+            // Registers every Pokémon written in the dex
+            bool registerDex = true;
+            // Validation and conversion fan out over this many threads, 0 using every core.
+            // Conversions call randomNumber, which then has to be safe to call concurrently.
+            // Writing to the save always happens on the calling thread
+            unsigned threads = 1;
         };
 
         virtual ~Sav() = default;
 
-        Sav(const std::shared_ptr<u8[]>& data, u32 length) : data(data), length(length) {}
+        Sav(const std::shared_ptr<u8[]>& data, u32 length)
+            : data(data),
+              length(length),
+              dirtyPages((length + DIRTY_PAGE_SIZE - 1) / DIRTY_PAGE_SIZE, true)
+        {
+        }
 
         Sav(const Sav& save)            = delete;
         Sav& operator=(const Sav& save) = delete;
@@ -125,9 +202,25 @@ namespace pksm
         // Must be called to continue editing after calling finishEditing.
         // Not necessary directly after construction
         virtual void beginEditing(void) = 0;
+        // When enabled, finishEditing only resigns what was modified through this class since the
+        // previous finishEditing. Anything written to rawData() directly must then be reported
+        // through markDirty
+        void trackChanges(bool enable);
+        // Records that [offset, offset + size) of rawData() is about to be modified
+        void markDirty(u32 offset, u32 size);
 
         [[nodiscard]] BadTransferReason invalidTransferReason(const PKX& pk) const;
         [[nodiscard]] std::unique_ptr<PKX> transfer(const PKX& pk);
+        // Validates, converts, writes and registers pks in one pass, pks[i] going to slot
+        // box * 30 + slot + i. Null entries leave their slot alone. Returns why each entry was
+        // rejected, or OKAY if it was written; entries past the last box are not included
+        [[nodiscard]] std::vector<BadTransferReason> transferBatch(
+            std::span<const PKX* const> pks, u8 box, u8 slot, const TransferOptions& options);
+        [[nodiscard]] std::vector<BadTransferReason> transferBatch(
+            std::span<const PKX* const> pks, u8 box, u8 slot)
+        {
+            return transferBatch(pks, box, slot, TransferOptions{});
+        }
         [[nodiscard]] static bool isValidDSSave(const std::shared_ptr<u8[]>& dt);
         [[nodiscard]] static std::unique_ptr<Sav> getSave(
             const std::shared_ptr<u8[]>& dt, size_t length);
@@ -180,6 +273,8 @@ namespace pksm
         virtual void trade(PKX& pk,
             const Date& date = Date::today()) const = 0; // Look into bank boolean parameter
         [[nodiscard]] virtual std::unique_ptr<PKX> emptyPkm() const = 0;
+        // Decodes every box and party slot into a BoxSnapshot
+        [[nodiscard]] BoxSnapshot snapshot(void) const { return BoxSnapshot(*this); }
 
         virtual void dex(const PKX& pk)                                       = 0;
         [[nodiscard]] virtual int dexSeen(void) const                         = 0;
@@ -104,7 +104,11 @@ namespace pksm
 
         void resign(void);
 
-        void finishEditing(void) override { resign(); }
+        void finishEditing(void) override
+        {
+            resign();
+            clearDirty();
+        }
 
         void beginEditing(void) override {}
 
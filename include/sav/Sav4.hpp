@@ -28,6 +28,8 @@
 #define SAV4_HPP
 
 #include "personal/personal.hpp"
+#include "pkx/PK4.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
 
 namespace pksm
@@ -65,7 +67,11 @@ namespace pksm
 
         void resign(void);
 
-        void finishEditing(void) override { resign(); }
+        void finishEditing(void) override
+        {
+            resign();
+            clearDirty();
+        }
 
         void beginEditing(void) override {}
 
@@ -126,6 +132,10 @@ namespace pksm
         // crypts them back during resigning
         void pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade) override;
         void pkm(const PKX& pk, u8 slot) override;
+        // Views of box slots, valid while the boxes are decrypted by cryptBoxData(true). The
+        // mutable one marks its slot dirty, so use the const one for passes that only read
+        [[nodiscard]] PKView<PK4> pkmView(u8 box, u8 slot);
+        [[nodiscard]] ConstPKView<PK4> pkmConstView(u8 box, u8 slot) const;
 
         void trade(PKX& pk, const Date& date = Date::today()) const override;
         [[nodiscard]] std::unique_ptr<PKX> emptyPkm() const override;
@@ -28,6 +28,8 @@
 #define SAV7_HPP
 
 #include "personal/personal.hpp"
+#include "pkx/PK7.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
 
 namespace pksm
@@ -51,7 +53,11 @@ namespace pksm
 
         virtual void resign(void) = 0;
 
-        void finishEditing(void) override { resign(); }
+        void finishEditing(void) override
+        {
+            resign();
+            clearDirty();
+        }
 
         void beginEditing(void) override {}
 
@@ -104,6 +110,10 @@ namespace pksm
         // crypts them back during resigning
         void pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade) override;
         void pkm(const PKX& pk, u8 slot) override;
+        // Views of box slots, valid while the boxes are decrypted by cryptBoxData(true). The
+        // mutable one marks its slot dirty, so use the const one for passes that only read
+        [[nodiscard]] PKView<PK7> pkmView(u8 box, u8 slot);
+        [[nodiscard]] ConstPKView<PK7> pkmConstView(u8 box, u8 slot) const;
 
         void trade(PKX& pk, const Date& date = Date::today()) const override;
         [[nodiscard]] std::unique_ptr<PKX> emptyPkm() const override;
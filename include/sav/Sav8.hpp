@@ -36,16 +36,35 @@ namespace pksm
     class Sav8 : public Sav
     {
     protected:
-        std::vector<std::shared_ptr<pksm::crypto::swsh::SCBlock>> blocks;
+        // Blocks are decrypted on demand, even through const accessors
+        mutable pksm::crypto::swsh::SCBlockList blocks;
 
         int Items, BoxLayout, Misc, TrainerCard, PlayTime, Status;
 
         bool encrypted = false;
 
+        unsigned threads;
+
+        // Decrypts a block and keeps it decrypted across beginEditing(), so that its data may be
+        // cached by accessors. Returns nullptr if the block doesn't exist
+        [[nodiscard]] u8* pinBlock(u32 key);
+
+    private:
+        std::vector<pksm::crypto::swsh::SCBlock> pinnedBlocks;
+
     public:
-        Sav8(const std::shared_ptr<u8[]>& dt, size_t length);
+        // If lazyBlocks is set, each block is only decrypted the first time it is accessed, and
+        // rawData() holds untouched blocks in their encrypted form until finishEditing().
+        // threads is the number of threads used to decrypt blocks on load and encrypt them in
+        // finishEditing(); 0 uses every available core
+        Sav8(const std::shared_ptr<u8[]>& dt, size_t length, bool lazyBlocks = false,
+            unsigned threads = 1);
 
-        [[nodiscard]] std::shared_ptr<pksm::crypto::swsh::SCBlock> getBlock(u32 key) const;
+        // Returns a null handle if the block doesn't exist
+        [[nodiscard]] pksm::crypto::swsh::SCBlock getBlock(u32 key) const
+        {
+            return blocks.find(key);
+        }
 
         void finishEditing(void) override;
         void beginEditing(void) override;
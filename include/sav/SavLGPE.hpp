@@ -28,6 +28,8 @@
 #define SAVLGPE_HPP
 
 #include "personal/personal.hpp"
+#include "pkx/PB7.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
 
 namespace pksm
@@ -57,7 +59,11 @@ namespace pksm
         SavLGPE(const std::shared_ptr<u8[]>& dt, size_t length);
         void resign(void);
 
-        void finishEditing(void) override { resign(); }
+        void finishEditing(void) override
+        {
+            resign();
+            clearDirty();
+        }
 
         void beginEditing(void) override {}
 
@@ -132,6 +138,10 @@ namespace pksm
         // crypts them back during resigning
         void pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade) override;
         void pkm(const PKX& pk, u8 slot) override;
+        // Views of box slots, valid while the boxes are decrypted by cryptBoxData(true). The
+        // mutable one marks its slot dirty, so use the const one for passes that only read
+        [[nodiscard]] PKView<PB7> pkmView(u8 box, u8 slot);
+        [[nodiscard]] ConstPKView<PB7> pkmConstView(u8 box, u8 slot) const;
 
         void trade(PKX& pk, const Date& date = Date::today()) const override;
         [[nodiscard]] std::unique_ptr<PKX> emptyPkm() const override;
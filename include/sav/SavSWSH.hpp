@@ -27,6 +27,8 @@
 #ifndef SAVSWSH_HPP
 #define SAVSWSH_HPP
 
+#include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav8.hpp"
 
 namespace pksm
@@ -35,6 +37,11 @@ namespace pksm
     {
     private:
         int ArmorDex, CrownDex;
+
+        // Data of the blocks used by the accessors, resolved and decrypted once on construction
+        u8 *boxBlock, *partyBlock, *dexBlock, *armorDexBlock, *crownDexBlock, *itemBlock,
+            *boxLayoutBlock, *miscBlock, *trainerCardBlock, *playTimeBlock, *statusBlock,
+            *currentBoxBlock, *wallpaperBlock;
         static constexpr std::array<u16, 25> gigaSpecies = {6, 12, 25, 52, 68, 94, 99, 131, 133,
             143, 569, 823, 826, 834, 839, 841, 842, 844, 851, 858, 861, 869, 879, 884, 890};
 
@@ -48,7 +55,8 @@ namespace pksm
         static constexpr size_t SIZE_G8SWSH_3B = 0x187668; // 1.0 -> 1.2 -> 1.3
         static constexpr size_t SIZE_G8SWSH_3C = 0x18764A; // 1.0 -> 1.3
 
-        SavSWSH(const std::shared_ptr<u8[]>& dt, size_t length);
+        SavSWSH(const std::shared_ptr<u8[]>& dt, size_t length, bool lazyBlocks = false,
+            unsigned threads = 1);
 
         [[nodiscard]] u16 TID(void) const override;
         void TID(u16 v) override;
@@ -122,6 +130,9 @@ namespace pksm
         // crypts them back during resigning
         void pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade) override;
         void pkm(const PKX& pk, u8 slot) override;
+        // Views of box slots, valid while the boxes are decrypted by cryptBoxData(true)
+        [[nodiscard]] PKView<PK8> pkmView(u8 box, u8 slot);
+        [[nodiscard]] ConstPKView<PK8> pkmConstView(u8 box, u8 slot) const;
 
         void cryptBoxData(bool crypted) override;
 
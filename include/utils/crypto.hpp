@@ -29,9 +29,13 @@
 
 #include "utils/coretypes.h"
 #include <array>
+#include <bit>
+#include <cstring>
 #include <memory>
 #include <span>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace pksm::crypto
@@ -101,10 +105,13 @@ namespace pksm::crypto
 
     namespace swsh
     {
+        class SCBlockList;
+
+        // Lightweight, non-owning handle to one block of an SCBlockList. Only valid for as long as
+        // the list it came from is neither destroyed nor moved
         class SCBlock
         {
-            friend std::vector<std::shared_ptr<SCBlock>> getBlockList(
-                std::shared_ptr<u8[]> data, size_t length);
+            friend class SCBlockList;
 
         public:
             enum class SCBlockType : u8
@@ -130,46 +137,94 @@ namespace pksm::crypto
                 Float  = 16,
                 Double = 17,
             };
+
+            // A null handle, as returned for keys that aren't present
+            SCBlock() = default;
+
+            explicit operator bool() const { return list != nullptr; }
+
             u32 key() const;
             // Nop if in proper state
             void encrypt();
             void decrypt();
 
-            u8* decryptedData()
-            {
-                decrypt();
-                return rawData();
-            }
+            u8* decryptedData();
 
         private:
-            SCBlock(std::shared_ptr<u8[]> data, size_t& offset);
-            SCBlock(const SCBlock&)            = delete;
-            SCBlock& operator=(const SCBlock&) = delete;
+            SCBlock(SCBlockList* list, size_t index) : list(list), index(index) {}
+
+            SCBlockList* list = nullptr;
+            size_t index      = 0;
+        };
+
+        // Flat descriptor table of every block in a save, indexed by position and kept sorted by
+        // key, as the game writes them. Block contents live in the save buffer itself
+        class SCBlockList
+        {
+            friend class SCBlock;
+            friend SCBlockList getBlockList(std::shared_ptr<u8[]> data, size_t length, bool lazy);
+
+        public:
+            SCBlockList()                              = default;
+            SCBlockList(SCBlockList&&)                 = default;
+            SCBlockList& operator=(SCBlockList&&)      = default;
+            SCBlockList(const SCBlockList&)            = delete;
+            SCBlockList& operator=(const SCBlockList&) = delete;
+
+            [[nodiscard]] size_t size() const { return keys.size(); }
+
+            [[nodiscard]] SCBlock operator[](size_t index) { return SCBlock{this, index}; }
+
+            // Returns a null handle if no block has that key
+            [[nodiscard]] SCBlock find(u32 key);
+
+        private:
+            using SCBlockType = SCBlock::SCBlockType;
 
             // Returns pointer to data at the beginning of the block's data region, skipping block
             // identifying information
-            u8* rawData() const { return data.get() + myOffset + headerSize(type); }
-
-            void key(u32 v);
-            // data.get() + myOffset points to the beginning of the block data: *(u32*)(data.get() +
-            // myOffset) == key
-            std::shared_ptr<u8[]> data = nullptr;
-            size_t myOffset;
-            size_t dataLength;
-            SCBlockType type;
-            SCBlockType subtype;
-            bool currentlyEncrypted = false;
+            [[nodiscard]] u8* rawData(size_t index) const
+            {
+                return data.get() + offsets[index] + headerSize(types[index]);
+            }
 
-            size_t encryptedDataSize();
             static size_t arrayEntrySize(SCBlockType type);
             static size_t headerSize(SCBlockType type);
+
+            std::shared_ptr<u8[]> data = nullptr;
+            // data.get() + offsets[i] points to the beginning of the block: *(u32*)(data.get() +
+            // offsets[i]) == keys[i]. sizes[i] counts everything from there, including the key
+            std::vector<u32> keys;
+            std::vector<u32> offsets;
+            std::vector<u32> sizes;
+            std::vector<SCBlockType> types;
+            std::vector<SCBlockType> subtypes;
+            // Not a vector<bool> so that different blocks may be (de/en)crypted concurrently
+            std::vector<u8> encrypted;
         };
 
+        inline u32 SCBlock::key() const
+        {
+            return list->keys[index];
+        }
+
+        inline u8* SCBlock::decryptedData()
+        {
+            decrypt();
+            return list->rawData(index);
+        }
+
+        // Applies the xorpad to the whole save, excluding the trailing hash
         void applyXor(std::shared_ptr<u8[]> data, size_t length);
+        // Applies the xorpad to an arbitrary range of the save in place. padOffset is the offset
+        // of the first byte of the range from the start of the save
+        void applyXor(std::span<u8> data, size_t padOffset = 0);
         void sign(std::shared_ptr<u8[]> data, size_t length);
         [[nodiscard]] bool verify(std::shared_ptr<u8[]> data, size_t length);
-        [[nodiscard]] std::vector<std::shared_ptr<SCBlock>> getBlockList(
-            std::shared_ptr<u8[]> data, size_t length);
+        // If lazy is set, only each block's header is read and its data is left encrypted until
+        // it is first requested through decryptedData()
+        [[nodiscard]] SCBlockList getBlockList(
+            std::shared_ptr<u8[]> data, size_t length, bool lazy = false);
     }
 
     namespace pkm
@@ -208,25 +263,162 @@ namespace pksm::crypto
             }
         }
 
+        namespace internal
+        {
+            // Multiplier and addend that advance seedStep by the given number of steps at once
+            [[nodiscard]] constexpr std::pair<u32, u32> seedJump(size_t steps)
+            {
+                u32 mul = 1, add = 0;
+                for (size_t i = 0; i < steps; i++)
+                {
+                    mul *= 0x41C64E6D;
+                    add = add * 0x41C64E6D + 0x6073;
+                }
+                return {mul, add};
+            }
+
+            constexpr size_t CRYPT_LANES = 8;
+
+            // Keeps CRYPT_LANES consecutive seeds and jumps each of them CRYPT_LANES steps per
+            // iteration, so that the words of one chunk don't depend on each other and the loops
+            // below can be vectorized. Little endian hosts only
+            inline void cryptLanes(u8* data, size_t size, u32 key)
+            {
+                static constexpr auto jump = seedJump(CRYPT_LANES);
+
+                u32 seeds[CRYPT_LANES];
+                for (size_t lane = 0; lane < CRYPT_LANES; lane++)
+                {
+                    key         = seedStep(key);
+                    seeds[lane] = key;
+                }
+
+                size_t i = 0;
+                for (; i + CRYPT_LANES * 2 <= size; i += CRYPT_LANES * 2)
+                {
+                    u16 words[CRYPT_LANES];
+                    std::memcpy(words, data + i, sizeof(words));
+                    for (size_t lane = 0; lane < CRYPT_LANES; lane++)
+                    {
+                        words[lane] ^= u16(seeds[lane] >> 16);
+                    }
+                    std::memcpy(data + i, words, sizeof(words));
+                    for (size_t lane = 0; lane < CRYPT_LANES; lane++)
+                    {
+                        seeds[lane] = seeds[lane] * jump.first + jump.second;
+                    }
+                }
+
+                // The seeds now hold the keys for the remaining words, in order
+                for (size_t lane = 0; i < size; i += 2, lane++)
+                {
+                    data[i]     ^= (seeds[lane] >> 16);
+                    data[i + 1] ^= (seeds[lane] >> 24);
+                }
+            }
+        }
+
         template <size_t Size>
         constexpr void crypt(u8* data, u32 key)
         {
-            for (size_t i = 0; i < Size; i += 2)
+            if (std::is_constant_evaluated() || std::endian::native != std::endian::little)
+            {
+                for (size_t i = 0; i < Size; i += 2)
+                {
+                    key         = seedStep(key);
+                    data[i]     ^= (key >> 16);
+                    data[i + 1] ^= (key >> 24);
+                }
+            }
+            else
+            {
+                internal::cryptLanes(data, Size, key);
+            }
+        }
+
+        namespace internal
+        {
+            // Walks the four blocks of a PKX column by column, so that the shuffle can be done in
+            // place with only one word per block in flight. Each block gets its own LCG lane,
+            // started at that block's position in the keystream. Returns the sum of the plaintext
+            template <size_t BlockLength, size_t EncryptionStart, bool Encrypt>
+            constexpr u16 cryptBlocks(u8* data, const u8* order, u32 key)
             {
-                key         = seedStep(key);
-                data[i]     ^= (key >> 16);
-                data[i + 1] ^= (key >> 24);
+                constexpr auto jump = seedJump(BlockLength / 2);
+
+                u8* blocks = data + EncryptionStart;
+                u32 seeds[4];
+                seeds[0] = key;
+                for (size_t block = 1; block < 4; block++)
+                {
+                    seeds[block] = seeds[block - 1] * jump.first + jump.second;
+                }
+
+                u16 checksum = 0;
+                for (size_t i = 0; i < BlockLength; i += 2)
+                {
+                    u16 plain[4];
+                    for (size_t block = 0; block < 4; block++)
+                    {
+                        u8* word     = blocks + block * BlockLength + i;
+                        plain[block] = u16(word[0] | (word[1] << 8));
+                        if constexpr (!Encrypt)
+                        {
+                            seeds[block] = seedStep(seeds[block]);
+                            plain[block] ^= u16(seeds[block] >> 16);
+                        }
+                        checksum += plain[block];
+                    }
+                    for (size_t block = 0; block < 4; block++)
+                    {
+                        u16 out = plain[order[block]];
+                        if constexpr (Encrypt)
+                        {
+                            seeds[block] = seedStep(seeds[block]);
+                            out          ^= u16(seeds[block] >> 16);
+                        }
+                        u8* word = blocks + block * BlockLength + i;
+                        word[0]  = u8(out);
+                        word[1]  = u8(out >> 8);
+                    }
+                }
+                return checksum;
             }
         }
 
+        // Equivalent to blockShuffle<BlockLength>(data + EncryptionStart,
+        // InvertedBlockPositions[sv]) followed by crypt over the four blocks, done in a single
+        // pass. Returns the checksum of the data before encryption
+        template <size_t BlockLength, size_t EncryptionStart>
+        constexpr u16 encryptBlocks(u8* data, u8 sv, u32 key)
+        {
+            return internal::cryptBlocks<BlockLength, EncryptionStart, true>(
+                data, &BlockPositions[InvertedBlockPositions[sv] * 4], key);
+        }
+
+        // Reverses encryptBlocks. Returns the checksum of the decrypted data
+        template <size_t BlockLength, size_t EncryptionStart>
+        constexpr u16 decryptBlocks(u8* data, u8 sv, u32 key)
+        {
+            return internal::cryptBlocks<BlockLength, EncryptionStart, false>(
+                data, &BlockPositions[sv * 4], key);
+        }
+
         [[deprecated("Use the templated version wherever possible")]] constexpr void crypt(
             std::span<u8> data, u32 key)
         {
-            for (size_t i = 0; i < data.size(); i += 2)
+            if (std::is_constant_evaluated() || std::endian::native != std::endian::little)
+            {
+                for (size_t i = 0; i < data.size(); i += 2)
+                {
+                    key         = seedStep(key);
+                    data[i]     ^= (key >> 16);
+                    data[i + 1] ^= (key >> 24);
+                }
+            }
+            else
             {
-                key         = seedStep(key);
-                data[i]     ^= (key >> 16);
-                data[i + 1] ^= (key >> 24);
+                internal::cryptLanes(data.data(), data.size(), key);
             }
         }
     }
@@ -0,0 +1,106 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62, Pk11
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include "utils/coretypes.h"
+#include <algorithm>
+#include <cstddef>
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+#endif
+
+namespace pksm
+{
+    // Calls func(i) once for every i in [0, count), spread over up to maxThreads threads including
+    // the calling one. A maxThreads of 0 uses every available core. Work is handed out one index
+    // at a time, so uneven items balance themselves. The first exception thrown by func is
+    // rethrown on the calling thread once every worker has stopped.
+    // Always runs serially on the calling thread if _PKSMCORE_DISABLE_THREAD_SAFETY is defined.
+    template <typename Func>
+    void parallelFor(size_t count, [[maybe_unused]] unsigned maxThreads, Func&& func)
+    {
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+        if (maxThreads == 0)
+        {
+            maxThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        size_t threadCount = std::min<size_t>(maxThreads, count);
+        if (threadCount > 1)
+        {
+            std::atomic<size_t> next = 0;
+            std::atomic<bool> failed = false;
+            std::exception_ptr error = nullptr;
+
+            auto worker = [&]()
+            {
+                try
+                {
+                    for (size_t i = next++; i < count && !failed; i = next++)
+                    {
+                        func(i);
+                    }
+                }
+                catch (...)
+                {
+                    if (!failed.exchange(true))
+                    {
+                        error = std::current_exception();
+                    }
+                }
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(threadCount - 1);
+            for (size_t i = 0; i < threadCount - 1; i++)
+            {
+                threads.emplace_back(worker);
+            }
+            worker();
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+            return;
+        }
+#endif
+        for (size_t i = 0; i < count; i++)
+        {
+            func(i);
+        }
+    }
+}
+
+#endif
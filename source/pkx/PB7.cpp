@@ -26,6 +26,7 @@
 
 #include "pkx/PB7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/utils.hpp"
@@ -36,17 +37,7 @@ namespace pksm
     {
         if (!isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            refreshChecksum();
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
-                data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
-            }
+            encrypt(data, isParty());
         }
     }
 
@@ -54,22 +45,42 @@ namespace pksm
     {
         if (isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
-            }
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+            decrypt(data, isParty());
         }
     }
 
     bool PB7::isEncrypted() const
     {
-        return LittleEndian::convertTo<u16>(data + 0xC8) != 0 &&
-               LittleEndian::convertTo<u16>(data + 0x58) != 0;
+        return isEncrypted(data);
+    }
+
+    void PB7::encrypt(u8* dt, bool party)
+    {
+        u32 ec  = LittleEndian::convertTo<u32>(dt);
+        u8 sv   = (ec >> 13) & 31;
+        u16 chk = pksm::crypto::pkm::encryptBlocks<BLOCK_LENGTH, ENCRYPTION_START>(dt, sv, ec);
+        LittleEndian::convertFrom<u16>(dt + 6, chk);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(dt + BOX_LENGTH, ec);
+        }
+    }
+
+    void PB7::decrypt(u8* dt, bool party)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(dt);
+        u8 sv  = (ec >> 13) & 31;
+        pksm::crypto::pkm::decryptBlocks<BLOCK_LENGTH, ENCRYPTION_START>(dt, sv, ec);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(dt + BOX_LENGTH, ec);
+        }
+    }
+
+    bool PB7::isEncrypted(const u8* dt)
+    {
+        return LittleEndian::convertTo<u16>(dt + 0xC8) != 0 &&
+               LittleEndian::convertTo<u16>(dt + 0x58) != 0;
     }
 
     PB7::PB7(PrivateConstructor, u8* dt, bool party, bool direct)
@@ -778,13 +789,7 @@ namespace pksm
 
     u8 PB7::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExperience(experience(), expType());
     }
 
     void PB7::level(u8 v)
@@ -1003,6 +1008,14 @@ namespace pksm
     std::unique_ptr<PK8> PB7::convertToG8(Sav& save) const
     {
         auto pk8 = PKX::getPKM<Generation::EIGHT>(nullptr, PK8::BOX_LENGTH);
+        convertToG8(save, pk8->rawData().data());
+        return pk8;
+    }
+
+    void PB7::convertToG8(Sav& save, u8* out) const
+    {
+        std::fill_n(out, PK8::BOX_LENGTH, 0);
+        PKView<PK8> pk8(out);
 
         // Note: Locale stuff does not transfer
         pk8->encryptionConstant(encryptionConstant());
@@ -1058,7 +1071,5 @@ namespace pksm
         pk8->weight(weight());
 
         pk8->refreshChecksum();
-
-        return pk8;
     }
 }
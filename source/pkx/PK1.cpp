@@ -32,6 +32,7 @@
 #include "pkx/PK6.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
@@ -145,6 +146,14 @@ namespace pksm
     std::unique_ptr<PK7> PK1::convertToG7(Sav& save) const
     {
         auto pk7 = PKX::getPKM<Generation::SEVEN>(nullptr, PK7::BOX_LENGTH);
+        convertToG7(save, pk7->rawData().data());
+        return pk7;
+    }
+
+    void PK1::convertToG7(Sav& save, u8* out) const
+    {
+        std::fill_n(out, PK7::BOX_LENGTH, 0);
+        PKView<PK7> pk7(out);
 
         pk7->encryptionConstant(randomNumber(0, 0xFFFFFFFF));
         pk7->PID(randomNumber(0, 0xFFFFFFFF));
@@ -246,16 +255,20 @@ namespace pksm
 
         pk7->fixMoves();
         pk7->refreshChecksum();
-        return pk7;
     }
 
     std::unique_ptr<PK8> PK1::convertToG8(Sav& save) const
     {
-        if (auto pk7 = convertToG7(save))
-        {
-            return pk7->convertToG8(save);
-        }
-        return nullptr;
+        auto pk8 = PKX::getPKM<Generation::EIGHT>(nullptr, PK8::BOX_LENGTH);
+        convertToG8(save, pk8->rawData().data());
+        return pk8;
+    }
+
+    void PK1::convertToG8(Sav& save, u8* out) const
+    {
+        u8 pk7[PK7::BOX_LENGTH];
+        convertToG7(save, pk7);
+        PKView<PK7>(pk7)->convertToG8(save, out);
     }
 
     std::unique_ptr<PKX> PK1::clone() const
@@ -546,13 +559,7 @@ namespace pksm
 
     u8 PK1::level() const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExperience(experience(), expType());
     }
 
     void PK1::level(u8 v)
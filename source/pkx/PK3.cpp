@@ -32,6 +32,7 @@
 #include "pkx/PK6.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
@@ -740,7 +741,14 @@ namespace pksm
         return pk2;
     }
 
-    std::unique_ptr<PK4> PK3::convertToG4(Sav&) const
+    std::unique_ptr<PK4> PK3::convertToG4(Sav& save) const
+    {
+        auto pk4 = PKX::getPKM<Generation::FOUR>(nullptr, PK4::BOX_LENGTH);
+        convertToG4(save, pk4->rawData().data());
+        return pk4;
+    }
+
+    void PK3::convertToG4(Sav&, u8* out) const
     {
         static constexpr std::array<std::array<u8, 18>, 7> trashBytes = {
             {
@@ -760,7 +768,8 @@ namespace pksm
              }
         };
 
-        auto pk4 = PKX::getPKM<Generation::FOUR>(nullptr, PK4::BOX_LENGTH);
+        std::fill_n(out, PK4::BOX_LENGTH, 0);
+        PKView<PK4> pk4(out);
 
         pk4->species(species());
         pk4->TID(TID());
@@ -888,82 +897,67 @@ namespace pksm
         pk4->fixMoves();
 
         pk4->refreshChecksum();
-        return pk4;
     }
 
     std::unique_ptr<PK5> PK3::convertToG5(Sav& save) const
     {
-        auto pk4 = convertToG4(save);
-        if (pk4)
-        {
-            return pk4->convertToG5(save);
-        }
-        return nullptr;
+        auto pk5 = PKX::getPKM<Generation::FIVE>(nullptr, PK5::BOX_LENGTH);
+        convertToG5(save, pk5->rawData().data());
+        return pk5;
+    }
+
+    void PK3::convertToG5(Sav& save, u8* out) const
+    {
+        u8 pk4[PK4::BOX_LENGTH];
+        convertToG4(save, pk4);
+        PKView<PK4>(pk4)->convertToG5(save, out);
     }
 
     std::unique_ptr<PK6> PK3::convertToG6(Sav& save) const
     {
-        auto pk4 = convertToG4(save);
-        if (pk4)
-        {
-            auto pk5 = pk4->convertToG5(save);
-            if (pk5)
-            {
-                return pk5->convertToG6(save);
-            }
-        }
-        return nullptr;
+        auto pk6 = PKX::getPKM<Generation::SIX>(nullptr, PK6::BOX_LENGTH);
+        convertToG6(save, pk6->rawData().data());
+        return pk6;
+    }
+
+    void PK3::convertToG6(Sav& save, u8* out) const
+    {
+        u8 pk5[PK5::BOX_LENGTH];
+        convertToG5(save, pk5);
+        PKView<PK5>(pk5)->convertToG6(save, out);
     }
 
     std::unique_ptr<PK7> PK3::convertToG7(Sav& save) const
     {
-        auto pk4 = convertToG4(save);
-        if (pk4)
-        {
-            auto pk5 = pk4->convertToG5(save);
-            if (pk5)
-            {
-                auto pk6 = pk5->convertToG6(save);
-                if (pk6)
-                {
-                    return pk6->convertToG7(save);
-                }
-            }
-        }
-        return nullptr;
+        auto pk7 = PKX::getPKM<Generation::SEVEN>(nullptr, PK7::BOX_LENGTH);
+        convertToG7(save, pk7->rawData().data());
+        return pk7;
+    }
+
+    void PK3::convertToG7(Sav& save, u8* out) const
+    {
+        u8 pk6[PK6::BOX_LENGTH];
+        convertToG6(save, pk6);
+        PKView<PK6>(pk6)->convertToG7(save, out);
     }
 
     std::unique_ptr<PK8> PK3::convertToG8(Sav& save) const
     {
-        auto pk4 = convertToG4(save);
-        if (pk4)
-        {
-            auto pk5 = pk4->convertToG5(save);
-            if (pk5)
-            {
-                auto pk6 = pk5->convertToG6(save);
-                if (pk6)
-                {
-                    auto pk7 = pk6->convertToG7(save);
-                    if (pk7)
-                    {
-                        return pk7->convertToG8(save);
-                    }
-                }
-            }
-        }
-        return nullptr;
+        auto pk8 = PKX::getPKM<Generation::EIGHT>(nullptr, PK8::BOX_LENGTH);
+        convertToG8(save, pk8->rawData().data());
+        return pk8;
+    }
+
+    void PK3::convertToG8(Sav& save, u8* out) const
+    {
+        u8 pk7[PK7::BOX_LENGTH];
+        convertToG7(save, pk7);
+        PKView<PK7>(pk7)->convertToG8(save, out);
     }
 
     u8 PK3::level() const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExperience(experience(), expType());
     }
 
     void PK3::level(u8 v)
@@ -32,6 +32,7 @@
 #include "pkx/PK6.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
@@ -221,16 +222,7 @@ namespace pksm
     {
         if (!isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            refreshChecksum();
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
-                data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, checksum());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, PID());
-            }
+            encrypt(data, isParty());
         }
     }
 
@@ -238,20 +230,47 @@ namespace pksm
     {
         if (isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, checksum());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, PID());
-            }
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+            decrypt(data, isParty());
         }
     }
 
     bool PK4::isEncrypted() const
     {
-        return LittleEndian::convertTo<u32>(data + 0x64) != 0;
+        return isEncrypted(data);
+    }
+
+    void PK4::encrypt(u8* dt, bool party)
+    {
+        u32 pid = LittleEndian::convertTo<u32>(dt);
+        u8 sv   = (pid >> 13) & 31;
+        u16 chk = 0;
+        for (size_t i = ENCRYPTION_START; i < BOX_LENGTH; i += 2)
+        {
+            chk += LittleEndian::convertTo<u16>(dt + i);
+        }
+        LittleEndian::convertFrom<u16>(dt + 6, chk);
+        pksm::crypto::pkm::encryptBlocks<BLOCK_LENGTH, ENCRYPTION_START>(dt, sv, chk);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(dt + BOX_LENGTH, pid);
+        }
+    }
+
+    void PK4::decrypt(u8* dt, bool party)
+    {
+        u32 pid = LittleEndian::convertTo<u32>(dt);
+        u8 sv   = (pid >> 13) & 31;
+        u16 chk = LittleEndian::convertTo<u16>(dt + 6);
+        pksm::crypto::pkm::decryptBlocks<BLOCK_LENGTH, ENCRYPTION_START>(dt, sv, chk);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(dt + BOX_LENGTH, pid);
+        }
+    }
+
+    bool PK4::isEncrypted(const u8* dt)
+    {
+        return LittleEndian::convertTo<u32>(dt + 0x64) != 0;
     }
 
     PK4::PK4(PrivateConstructor, u8* dt, bool party, bool direct)
@@ -924,13 +943,7 @@ namespace pksm
 
     u8 PK4::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExperience(experience(), expType());
     }
 
     void PK4::level(u8 v)
@@ -1201,9 +1214,21 @@ namespace pksm
         return pk3;
     }
 
-    std::unique_ptr<PK5> PK4::convertToG5(Sav&) const
+    std::unique_ptr<PK5> PK4::convertToG5(Sav& save) const
     {
-        auto pk5 = PKX::getPKM<Generation::FIVE>(const_cast<u8*>(data), PK5::BOX_LENGTH);
+        auto pk5 = PKX::getPKM<Generation::FIVE>(nullptr, PK5::BOX_LENGTH);
+        convertToG5(save, pk5->rawData().data());
+        return pk5;
+    }
+
+    void PK4::convertToG5(Sav&, u8* out) const
+    {
+        std::copy(data, data + PK5::BOX_LENGTH, out);
+        if (PK5::isEncrypted(out))
+        {
+            PK5::decrypt(out, false);
+        }
+        PKView<PK5> pk5(out);
 
         // Clear HGSS data
         LittleEndian::convertFrom<u16>(data + 0x86, 0);
@@ -1252,46 +1277,48 @@ namespace pksm
         pk5->fixMoves();
 
         pk5->refreshChecksum();
-        return pk5;
     }
 
     std::unique_ptr<PK6> PK4::convertToG6(Sav& save) const
     {
-        if (auto pk5 = convertToG5(save))
-        {
-            return pk5->convertToG6(save);
-        }
-        return nullptr;
+        auto pk6 = PKX::getPKM<Generation::SIX>(nullptr, PK6::BOX_LENGTH);
+        convertToG6(save, pk6->rawData().data());
+        return pk6;
+    }
+
+    void PK4::convertToG6(Sav& save, u8* out) const
+    {
+        u8 pk5[PK5::BOX_LENGTH];
+        convertToG5(save, pk5);
+        PKView<PK5>(pk5)->convertToG6(save, out);
     }
 
     std::unique_ptr<PK7> PK4::convertToG7(Sav& save) const
     {
-        if (auto pk5 = convertToG5(save))
-        {
-            if (auto pk6 = pk5->convertToG6(save))
-            {
-                return pk6->convertToG7(save);
-            }
-        }
-        return nullptr;
+        auto pk7 = PKX::getPKM<Generation::SEVEN>(nullptr, PK7::BOX_LENGTH);
+        convertToG7(save, pk7->rawData().data());
+        return pk7;
+    }
+
+    void PK4::convertToG7(Sav& save, u8* out) const
+    {
+        u8 pk6[PK6::BOX_LENGTH];
+        convertToG6(save, pk6);
+        PKView<PK6>(pk6)->convertToG7(save, out);
     }
 
     std::unique_ptr<PK8> PK4::convertToG8(Sav& save) const
     {
-        auto pk5 = convertToG5(save);
-        if (pk5)
-        {
-            auto pk6 = pk5->convertToG6(save);
-            if (pk6)
-            {
-                auto pk7 = pk6->convertToG7(save);
-                if (pk7)
-                {
-                    return pk7->convertToG8(save);
-                }
-            }
-        }
-        return nullptr;
+        auto pk8 = PKX::getPKM<Generation::EIGHT>(nullptr, PK8::BOX_LENGTH);
+        convertToG8(save, pk8->rawData().data());
+        return pk8;
+    }
+
+    void PK4::convertToG8(Sav& save, u8* out) const
+    {
+        u8 pk7[PK7::BOX_LENGTH];
+        convertToG7(save, pk7);
+        PKView<PK7>(pk7)->convertToG8(save, out);
     }
 
     void PK4::updatePartyData()
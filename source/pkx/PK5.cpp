@@ -32,6 +32,7 @@
 #include "pkx/PK6.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
@@ -305,16 +306,7 @@ namespace pksm
     {
         if (!isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            refreshChecksum();
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
-                data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, checksum());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, PID());
-            }
+            encrypt(data, isParty());
         }
     }
 
@@ -322,20 +314,47 @@ namespace pksm
     {
         if (isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, checksum());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, PID());
-            }
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+            decrypt(data, isParty());
         }
     }
 
     bool PK5::isEncrypted() const
     {
-        return LittleEndian::convertTo<u32>(data + 0x64) != 0;
+        return isEncrypted(data);
+    }
+
+    void PK5::encrypt(u8* dt, bool party)
+    {
+        u32 pid = LittleEndian::convertTo<u32>(dt);
+        u8 sv   = (pid >> 13) & 31;
+        u16 chk = 0;
+        for (size_t i = ENCRYPTION_START; i < BOX_LENGTH; i += 2)
+        {
+            chk += LittleEndian::convertTo<u16>(dt + i);
+        }
+        LittleEndian::convertFrom<u16>(dt + 6, chk);
+        pksm::crypto::pkm::encryptBlocks<BLOCK_LENGTH, ENCRYPTION_START>(dt, sv, chk);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(dt + BOX_LENGTH, pid);
+        }
+    }
+
+    void PK5::decrypt(u8* dt, bool party)
+    {
+        u32 pid = LittleEndian::convertTo<u32>(dt);
+        u8 sv   = (pid >> 13) & 31;
+        u16 chk = LittleEndian::convertTo<u16>(dt + 6);
+        pksm::crypto::pkm::decryptBlocks<BLOCK_LENGTH, ENCRYPTION_START>(dt, sv, chk);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(dt + BOX_LENGTH, pid);
+        }
+    }
+
+    bool PK5::isEncrypted(const u8* dt)
+    {
+        return LittleEndian::convertTo<u32>(dt + 0x64) != 0;
     }
 
     PK5::PK5(PrivateConstructor, u8* dt, bool party, bool direct)
@@ -951,13 +970,7 @@ namespace pksm
 
     u8 PK5::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExperience(experience(), expType());
     }
 
     void PK5::level(u8 v)
@@ -1160,6 +1173,14 @@ namespace pksm
     std::unique_ptr<PK6> PK5::convertToG6(Sav& save) const
     {
         auto pk6 = PKX::getPKM<Generation::SIX>(nullptr, PK6::BOX_LENGTH);
+        convertToG6(save, pk6->rawData().data());
+        return pk6;
+    }
+
+    void PK5::convertToG6(Sav& save, u8* out) const
+    {
+        std::fill_n(out, PK6::BOX_LENGTH, 0);
+        PKView<PK6> pk6(out);
 
         pk6->encryptionConstant(PID());
         pk6->species(species());
@@ -1368,7 +1389,6 @@ namespace pksm
         pk6->nickname(StringUtils::UCS2toUTF8(toFix));
 
         pk6->refreshChecksum();
-        return pk6;
     }
 
     std::unique_ptr<PK3> PK5::convertToG3(Sav& save) const
@@ -1382,25 +1402,30 @@ namespace pksm
 
     std::unique_ptr<PK7> PK5::convertToG7(Sav& save) const
     {
-        if (auto pk6 = convertToG6(save))
-        {
-            return pk6->convertToG7(save);
-        }
-        return nullptr;
+        auto pk7 = PKX::getPKM<Generation::SEVEN>(nullptr, PK7::BOX_LENGTH);
+        convertToG7(save, pk7->rawData().data());
+        return pk7;
+    }
+
+    void PK5::convertToG7(Sav& save, u8* out) const
+    {
+        u8 pk6[PK6::BOX_LENGTH];
+        convertToG6(save, pk6);
+        PKView<PK6>(pk6)->convertToG7(save, out);
     }
 
     std::unique_ptr<PK8> PK5::convertToG8(Sav& save) const
     {
-        auto pk6 = convertToG6(save);
-        if (pk6)
-        {
-            auto pk7 = pk6->convertToG7(save);
-            if (pk7)
-            {
-                return pk7->convertToG8(save);
-            }
-        }
-        return nullptr;
+        auto pk8 = PKX::getPKM<Generation::EIGHT>(nullptr, PK8::BOX_LENGTH);
+        convertToG8(save, pk8->rawData().data());
+        return pk8;
+    }
+
+    void PK5::convertToG8(Sav& save, u8* out) const
+    {
+        u8 pk7[PK7::BOX_LENGTH];
+        convertToG7(save, pk7);
+        PKView<PK7>(pk7)->convertToG8(save, out);
     }
 
     void PK5::updatePartyData()
@@ -32,6 +32,7 @@
 #include "pkx/PK5.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
@@ -188,17 +189,7 @@ namespace pksm
     {
         if (!isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            refreshChecksum();
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
-                data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
-            }
+            encrypt(data, isParty());
         }
     }
 
@@ -206,22 +197,42 @@ namespace pksm
     {
         if (isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
-            }
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+            decrypt(data, isParty());
         }
     }
 
     bool PK6::isEncrypted() const
     {
-        return LittleEndian::convertTo<u16>(data + 0xC8) != 0 &&
-               LittleEndian::convertTo<u16>(data + 0x58) != 0;
+        return isEncrypted(data);
+    }
+
+    void PK6::encrypt(u8* dt, bool party)
+    {
+        u32 ec  = LittleEndian::convertTo<u32>(dt);
+        u8 sv   = (ec >> 13) & 31;
+        u16 chk = pksm::crypto::pkm::encryptBlocks<BLOCK_LENGTH, ENCRYPTION_START>(dt, sv, ec);
+        LittleEndian::convertFrom<u16>(dt + 6, chk);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(dt + BOX_LENGTH, ec);
+        }
+    }
+
+    void PK6::decrypt(u8* dt, bool party)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(dt);
+        u8 sv  = (ec >> 13) & 31;
+        pksm::crypto::pkm::decryptBlocks<BLOCK_LENGTH, ENCRYPTION_START>(dt, sv, ec);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(dt + BOX_LENGTH, ec);
+        }
+    }
+
+    bool PK6::isEncrypted(const u8* dt)
+    {
+        return LittleEndian::convertTo<u16>(dt + 0xC8) != 0 &&
+               LittleEndian::convertTo<u16>(dt + 0x58) != 0;
     }
 
     PK6::PK6(PrivateConstructor, u8* dt, bool party, bool direct)
@@ -1124,13 +1135,7 @@ namespace pksm
 
     u8 PK6::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExperience(experience(), expType());
     }
 
     void PK6::level(u8 v)
@@ -1439,7 +1444,19 @@ namespace pksm
 
     std::unique_ptr<PK7> PK6::convertToG7(Sav& save) const
     {
-        auto pk7 = PKX::getPKM<Generation::SEVEN>(const_cast<u8*>(data), PK7::BOX_LENGTH);
+        auto pk7 = PKX::getPKM<Generation::SEVEN>(nullptr, PK7::BOX_LENGTH);
+        convertToG7(save, pk7->rawData().data());
+        return pk7;
+    }
+
+    void PK6::convertToG7(Sav& save, u8* out) const
+    {
+        std::copy(data, data + PK7::BOX_LENGTH, out);
+        if (PK7::isEncrypted(out))
+        {
+            PK7::decrypt(out, false);
+        }
+        PKView<PK7> pk7(out);
 
         // markvalue field moved, clear old gen 6 data
         pk7->rawData()[0x2A] = 0;
@@ -1491,17 +1508,20 @@ namespace pksm
         pk7->currentHandler(1);
 
         pk7->refreshChecksum();
-        return pk7;
     }
 
     std::unique_ptr<PK8> PK6::convertToG8(Sav& save) const
     {
-        auto pk7 = convertToG7(save);
-        if (pk7)
-        {
-            return pk7->convertToG8(save);
-        }
-        return nullptr;
+        auto pk8 = PKX::getPKM<Generation::EIGHT>(nullptr, PK8::BOX_LENGTH);
+        convertToG8(save, pk8->rawData().data());
+        return pk8;
+    }
+
+    void PK6::convertToG8(Sav& save, u8* out) const
+    {
+        u8 pk7[PK7::BOX_LENGTH];
+        convertToG7(save, pk7);
+        PKView<PK7>(pk7)->convertToG8(save, out);
     }
 
     void PK6::updatePartyData()
@@ -32,6 +32,7 @@
 #include "pkx/PK5.hpp"
 #include "pkx/PK6.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
@@ -160,17 +161,7 @@ namespace pksm
     {
         if (!isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            refreshChecksum();
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
-                data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
-            }
+            encrypt(data, isParty());
         }
     }
 
@@ -178,22 +169,42 @@ namespace pksm
     {
         if (isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
-            }
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+            decrypt(data, isParty());
         }
     }
 
     bool PK7::isEncrypted() const
     {
-        return LittleEndian::convertTo<u16>(data + 0xC8) != 0 &&
-               LittleEndian::convertTo<u16>(data + 0x58) != 0;
+        return isEncrypted(data);
+    }
+
+    void PK7::encrypt(u8* dt, bool party)
+    {
+        u32 ec  = LittleEndian::convertTo<u32>(dt);
+        u8 sv   = (ec >> 13) & 31;
+        u16 chk = pksm::crypto::pkm::encryptBlocks<BLOCK_LENGTH, ENCRYPTION_START>(dt, sv, ec);
+        LittleEndian::convertFrom<u16>(dt + 6, chk);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(dt + BOX_LENGTH, ec);
+        }
+    }
+
+    void PK7::decrypt(u8* dt, bool party)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(dt);
+        u8 sv  = (ec >> 13) & 31;
+        pksm::crypto::pkm::decryptBlocks<BLOCK_LENGTH, ENCRYPTION_START>(dt, sv, ec);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(dt + BOX_LENGTH, ec);
+        }
+    }
+
+    bool PK7::isEncrypted(const u8* dt)
+    {
+        return LittleEndian::convertTo<u16>(dt + 0xC8) != 0 &&
+               LittleEndian::convertTo<u16>(dt + 0x58) != 0;
     }
 
     PK7::PK7(PrivateConstructor, u8* dt, bool party, bool direct)
@@ -1057,13 +1068,7 @@ namespace pksm
 
     u8 PK7::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExperience(experience(), expType());
     }
 
     void PK7::level(u8 v)
@@ -1290,6 +1295,14 @@ namespace pksm
     std::unique_ptr<PK8> PK7::convertToG8(Sav& save) const
     {
         auto pk8 = PKX::getPKM<Generation::EIGHT>(nullptr, PK8::BOX_LENGTH);
+        convertToG8(save, pk8->rawData().data());
+        return pk8;
+    }
+
+    void PK7::convertToG8(Sav& save, u8* out) const
+    {
+        std::fill_n(out, PK8::BOX_LENGTH, 0);
+        PKView<PK8> pk8(out);
 
         // Note: Locale stuff does not transfer
         pk8->encryptionConstant(encryptionConstant());
@@ -1410,8 +1423,6 @@ namespace pksm
         // TODO: remove totem forms
 
         pk8->refreshChecksum();
-
-        return pk8;
     }
 
     int PK7::partyCurrHP(void) const
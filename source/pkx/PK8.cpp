@@ -247,17 +247,7 @@ namespace pksm
     {
         if (!isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            refreshChecksum();
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
-                data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
-            }
+            encrypt(data, isParty());
         }
     }
 
@@ -265,22 +255,42 @@ namespace pksm
     {
         if (isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
-            }
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+            decrypt(data, isParty());
         }
     }
 
     bool PK8::isEncrypted() const
     {
-        return LittleEndian::convertTo<u16>(data + 0x70) != 0 &&
-               LittleEndian::convertTo<u16>(data + 0xC0) != 0;
+        return isEncrypted(data);
+    }
+
+    void PK8::encrypt(u8* dt, bool party)
+    {
+        u32 ec  = LittleEndian::convertTo<u32>(dt);
+        u8 sv   = (ec >> 13) & 31;
+        u16 chk = pksm::crypto::pkm::encryptBlocks<BLOCK_LENGTH, ENCRYPTION_START>(dt, sv, ec);
+        LittleEndian::convertFrom<u16>(dt + 6, chk);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(dt + BOX_LENGTH, ec);
+        }
+    }
+
+    void PK8::decrypt(u8* dt, bool party)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(dt);
+        u8 sv  = (ec >> 13) & 31;
+        pksm::crypto::pkm::decryptBlocks<BLOCK_LENGTH, ENCRYPTION_START>(dt, sv, ec);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(dt + BOX_LENGTH, ec);
+        }
+    }
+
+    bool PK8::isEncrypted(const u8* dt)
+    {
+        return LittleEndian::convertTo<u16>(dt + 0x70) != 0 &&
+               LittleEndian::convertTo<u16>(dt + 0xC0) != 0;
     }
 
     PK8::PK8(PrivateConstructor, u8* dt, bool party, bool direct)
@@ -1287,13 +1297,7 @@ namespace pksm
 
     u8 PK8::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExperience(experience(), expType());
     }
 
     void PK8::level(u8 v)
@@ -1364,19 +1368,14 @@ namespace pksm
 
         if (stat == Stat::HP)
         {
-            calc =
-                10 + ((2 * basestat) +
-                         ((((data[0xDE] >> hyperTrainLookup[u8(stat)]) & 1) == 1) ? 31 : iv(stat)) +
-                         ev(stat) / 4 + 100) *
-                         level() / 100;
+            calc = 10 +
+                   ((2 * basestat) + (hyperTrain(stat) ? 31 : iv(stat)) + ev(stat) / 4 + 100) *
+                       level() / 100;
         }
         else
         {
-            calc =
-                5 + (2 * basestat +
-                        ((((data[0xDE] >> hyperTrainLookup[u8(stat)]) & 1) == 1) ? 31 : iv(stat)) +
-                        ev(stat) / 4) *
-                        level() / 100;
+            calc = 5 + (2 * basestat + (hyperTrain(stat) ? 31 : iv(stat)) + ev(stat) / 4) *
+                           level() / 100;
         }
         if (u8(nature()) / 5 + 1 == u8(stat))
         {
@@ -0,0 +1,86 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62, Pk11
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "pkx/PKVariant.hpp"
+
+namespace pksm
+{
+    std::optional<PKVariant> makePKVariant(Generation gen, u8* data, bool party)
+    {
+        switch (gen)
+        {
+            case Generation::ONE:
+                return PKVariant{std::in_place_type<PKView<PK1>>, data, party};
+            case Generation::TWO:
+                return PKVariant{std::in_place_type<PKView<PK2>>, data, party};
+            case Generation::THREE:
+                return PKVariant{std::in_place_type<PKView<PK3>>, data, party};
+            case Generation::FOUR:
+                return PKVariant{std::in_place_type<PKView<PK4>>, data, party};
+            case Generation::FIVE:
+                return PKVariant{std::in_place_type<PKView<PK5>>, data, party};
+            case Generation::SIX:
+                return PKVariant{std::in_place_type<PKView<PK6>>, data, party};
+            case Generation::SEVEN:
+                return PKVariant{std::in_place_type<PKView<PK7>>, data, party};
+            case Generation::LGPE:
+                return PKVariant{std::in_place_type<PKView<PB7>>, data, party};
+            case Generation::EIGHT:
+                return PKVariant{std::in_place_type<PKView<PK8>>, data, party};
+            case Generation::UNUSED:
+                return std::nullopt;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<ConstPKVariant> makeConstPKVariant(Generation gen, const u8* data, bool party)
+    {
+        switch (gen)
+        {
+            case Generation::ONE:
+                return ConstPKVariant{std::in_place_type<ConstPKView<PK1>>, data, party};
+            case Generation::TWO:
+                return ConstPKVariant{std::in_place_type<ConstPKView<PK2>>, data, party};
+            case Generation::THREE:
+                return ConstPKVariant{std::in_place_type<ConstPKView<PK3>>, data, party};
+            case Generation::FOUR:
+                return ConstPKVariant{std::in_place_type<ConstPKView<PK4>>, data, party};
+            case Generation::FIVE:
+                return ConstPKVariant{std::in_place_type<ConstPKView<PK5>>, data, party};
+            case Generation::SIX:
+                return ConstPKVariant{std::in_place_type<ConstPKView<PK6>>, data, party};
+            case Generation::SEVEN:
+                return ConstPKVariant{std::in_place_type<ConstPKView<PK7>>, data, party};
+            case Generation::LGPE:
+                return ConstPKVariant{std::in_place_type<ConstPKView<PB7>>, data, party};
+            case Generation::EIGHT:
+                return ConstPKVariant{std::in_place_type<ConstPKView<PK8>>, data, party};
+            case Generation::UNUSED:
+                return std::nullopt;
+        }
+        return std::nullopt;
+    }
+}
@@ -35,9 +35,158 @@
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
 #include "pkx/PKFilter.hpp"
+#include "pkx/PKVariant.hpp"
 #include "utils/endian.hpp"
 #include "utils/random.hpp"
 #include "utils/VersionTables.hpp"
+#include <array>
+#include <cmath>
+
+namespace
+{
+    // Experience needed for each level, one column per growth rate
+    constexpr u32 expTableRows[100][6] = {
+        {0,       0,      0,       0,       0,      0      },
+        {8,       15,     4,       9,       6,      10     },
+        {27,      52,     13,      57,      21,     33     },
+        {64,      122,    32,      96,      51,     80     },
+        {125,     237,    65,      135,     100,    156    },
+        {216,     406,    112,     179,     172,    270    },
+        {343,     637,    178,     236,     274,    428    },
+        {512,     942,    276,     314,     409,    640    },
+        {729,     1326,   393,     419,     583,    911    },
+        {1000,    1800,   540,     560,     800,    1250   },
+        {1331,    2369,   745,     742,     1064,   1663   },
+        {1728,    3041,   967,     973,     1382,   2160   },
+        {2197,    3822,   1230,    1261,    1757,   2746   },
+        {2744,    4719,   1591,    1612,    2195,   3430   },
+        {3375,    5737,   1957,    2035,    2700,   4218   },
+        {4096,    6881,   2457,    2535,    3276,   5120   },
+        {4913,    8155,   3046,    3120,    3930,   6141   },
+        {5832,    9564,   3732,    3798,    4665,   7290   },
+        {6859,    11111,  4526,    4575,    5487,   8573   },
+        {8000,    12800,  5440,    5460,    6400,   10000  },
+        {9261,    14632,  6482,    6458,    7408,   11576  },
+        {10648,   16610,  7666,    7577,    8518,   13310  },
+        {12167,   18737,  9003,    8825,    9733,   15208  },
+        {13824,   21012,  10506,   10208,   11059,  17280  },
+        {15625,   23437,  12187,   11735,   12500,  19531  },
+        {17576,   26012,  14060,   13411,   14060,  21970  },
+        {19683,   28737,  16140,   15244,   15746,  24603  },
+        {21952,   31610,  18439,   17242,   17561,  27440  },
+        {24389,   34632,  20974,   19411,   19511,  30486  },
+        {27000,   37800,  23760,   21760,   21600,  33750  },
+        {29791,   41111,  26811,   24294,   23832,  37238  },
+        {32768,   44564,  30146,   27021,   26214,  40960  },
+        {35937,   48155,  33780,   29949,   28749,  44921  },
+        {39304,   51881,  37731,   33084,   31443,  49130  },
+        {42875,   55737,  42017,   36435,   34300,  53593  },
+        {46656,   59719,  46656,   40007,   37324,  58320  },
+        {50653,   63822,  50653,   43808,   40522,  63316  },
+        {54872,   68041,  55969,   47846,   43897,  68590  },
+        {59319,   72369,  60505,   52127,   47455,  74148  },
+        {64000,   76800,  66560,   56660,   51200,  80000  },
+        {68921,   81326,  71677,   61450,   55136,  86151  },
+        {74088,   85942,  78533,   66505,   59270,  92610  },
+        {79507,   90637,  84277,   71833,   63605,  99383  },
+        {85184,   95406,  91998,   77440,   68147,  106480 },
+        {91125,   100237, 98415,   83335,   72900,  113906 },
+        {97336,   105122, 107069,  89523,   77868,  121670 },
+        {103823,  110052, 114205,  96012,   83058,  129778 },
+        {110592,  115015, 123863,  102810,  88473,  138240 },
+        {117649,  120001, 131766,  109923,  94119,  147061 },
+        {125000,  125000, 142500,  117360,  100000, 156250 },
+        {132651,  131324, 151222,  125126,  106120, 165813 },
+        {140608,  137795, 163105,  133229,  112486, 175760 },
+        {148877,  144410, 172697,  141677,  119101, 186096 },
+        {157464,  151165, 185807,  150476,  125971, 196830 },
+        {166375,  158056, 196322,  159635,  133100, 207968 },
+        {175616,  165079, 210739,  169159,  140492, 219520 },
+        {185193,  172229, 222231,  179056,  148154, 231491 },
+        {195112,  179503, 238036,  189334,  156089, 243890 },
+        {205379,  186894, 250562,  199999,  164303, 256723 },
+        {216000,  194400, 267840,  211060,  172800, 270000 },
+        {226981,  202013, 281456,  222522,  181584, 283726 },
+        {238328,  209728, 300293,  234393,  190662, 297910 },
+        {250047,  217540, 315059,  246681,  200037, 312558 },
+        {262144,  225443, 335544,  259392,  209715, 327680 },
+        {274625,  233431, 351520,  272535,  219700, 343281 },
+        {287496,  241496, 373744,  286115,  229996, 359370 },
+        {300763,  249633, 390991,  300140,  240610, 375953 },
+        {314432,  257834, 415050,  314618,  251545, 393040 },
+        {328509,  267406, 433631,  329555,  262807, 410636 },
+        {343000,  276458, 459620,  344960,  274400, 428750 },
+        {357911,  286328, 479600,  360838,  286328, 447388 },
+        {373248,  296358, 507617,  377197,  298598, 466560 },
+        {389017,  305767, 529063,  394045,  311213, 486271 },
+        {405224,  316074, 559209,  411388,  324179, 506530 },
+        {421875,  326531, 582187,  429235,  337500, 527343 },
+        {438976,  336255, 614566,  447591,  351180, 548720 },
+        {456533,  346965, 639146,  466464,  365226, 570666 },
+        {474552,  357812, 673863,  485862,  379641, 593190 },
+        {493039,  367807, 700115,  505791,  394431, 616298 },
+        {512000,  378880, 737280,  526260,  409600, 640000 },
+        {531441,  390077, 765275,  547274,  425152, 664301 },
+        {551368,  400293, 804997,  568841,  441094, 689210 },
+        {571787,  411686, 834809,  590969,  457429, 714733 },
+        {592704,  423190, 877201,  613664,  474163, 740880 },
+        {614125,  433572, 908905,  636935,  491300, 767656 },
+        {636056,  445239, 954084,  660787,  508844, 795070 },
+        {658503,  457001, 987754,  685228,  526802, 823128 },
+        {681472,  467489, 1035837, 710266,  545177, 851840 },
+        {704969,  479378, 1071552, 735907,  563975, 881211 },
+        {729000,  491346, 1122660, 762160,  583200, 911250 },
+        {753571,  501878, 1160499, 789030,  602856, 941963 },
+        {778688,  513934, 1214753, 816525,  622950, 973360 },
+        {804357,  526049, 1254796, 844653,  643485, 1005446},
+        {830584,  536557, 1312322, 873420,  664467, 1038230},
+        {857375,  548720, 1354652, 902835,  685900, 1071718},
+        {884736,  560922, 1415577, 932903,  707788, 1105920},
+        {912673,  571333, 1460276, 963632,  730138, 1140841},
+        {941192,  583539, 1524731, 995030,  752953, 1176490},
+        {970299,  591882, 1571884, 1027103, 776239, 1212873},
+        {1000000, 600000, 1640000, 1059860, 800000, 1250000}
+    };
+
+    // The same table transposed, so that each growth rate's curve is contiguous to search through
+    constexpr auto expCurves = []
+    {
+        std::array<std::array<u32, 100>, 6> ret{};
+        for (size_t row = 0; row < 100; row++)
+        {
+            for (size_t col = 0; col < 6; col++)
+            {
+                ret[col][row] = expTableRows[row][col];
+            }
+        }
+        return ret;
+    }();
+
+    // Inputs of the stat formula for a run of Pokémon, with one column per stat
+    struct StatColumns
+    {
+        explicit StatColumns(size_t count) : level(count), nature(count), shedinja(count)
+        {
+            for (size_t stat = 0; stat < 6; stat++)
+            {
+                base[stat].resize(count);
+                iv[stat].resize(count);
+                ev[stat].resize(count);
+                bonus[stat].resize(count);
+            }
+        }
+
+        std::vector<u16> level;
+        std::vector<u8> nature;
+        std::vector<u8> shedinja;
+        std::array<std::vector<u16>, 6> base;
+        // IV and EV terms as they enter the formula, with each generation's adjustments applied
+        std::array<std::vector<u16>, 6> iv;
+        std::array<std::vector<u16>, 6> ev;
+        // Added after the nature multiplier
+        std::array<std::vector<u16>, 6> bonus;
+    };
+}
 
 namespace pksm
 {
@@ -137,110 +286,138 @@ namespace pksm
 
     u32 PKX::expTable(u8 row, u8 col) const
     {
-        static constexpr u32 table[100][6] = {
-            {0,       0,      0,       0,       0,      0      },
-            {8,       15,     4,       9,       6,      10     },
-            {27,      52,     13,      57,      21,     33     },
-            {64,      122,    32,      96,      51,     80     },
-            {125,     237,    65,      135,     100,    156    },
-            {216,     406,    112,     179,     172,    270    },
-            {343,     637,    178,     236,     274,    428    },
-            {512,     942,    276,     314,     409,    640    },
-            {729,     1326,   393,     419,     583,    911    },
-            {1000,    1800,   540,     560,     800,    1250   },
-            {1331,    2369,   745,     742,     1064,   1663   },
-            {1728,    3041,   967,     973,     1382,   2160   },
-            {2197,    3822,   1230,    1261,    1757,   2746   },
-            {2744,    4719,   1591,    1612,    2195,   3430   },
-            {3375,    5737,   1957,    2035,    2700,   4218   },
-            {4096,    6881,   2457,    2535,    3276,   5120   },
-            {4913,    8155,   3046,    3120,    3930,   6141   },
-            {5832,    9564,   3732,    3798,    4665,   7290   },
-            {6859,    11111,  4526,    4575,    5487,   8573   },
-            {8000,    12800,  5440,    5460,    6400,   10000  },
-            {9261,    14632,  6482,    6458,    7408,   11576  },
-            {10648,   16610,  7666,    7577,    8518,   13310  },
-            {12167,   18737,  9003,    8825,    9733,   15208  },
-            {13824,   21012,  10506,   10208,   11059,  17280  },
-            {15625,   23437,  12187,   11735,   12500,  19531  },
-            {17576,   26012,  14060,   13411,   14060,  21970  },
-            {19683,   28737,  16140,   15244,   15746,  24603  },
-            {21952,   31610,  18439,   17242,   17561,  27440  },
-            {24389,   34632,  20974,   19411,   19511,  30486  },
-            {27000,   37800,  23760,   21760,   21600,  33750  },
-            {29791,   41111,  26811,   24294,   23832,  37238  },
-            {32768,   44564,  30146,   27021,   26214,  40960  },
-            {35937,   48155,  33780,   29949,   28749,  44921  },
-            {39304,   51881,  37731,   33084,   31443,  49130  },
-            {42875,   55737,  42017,   36435,   34300,  53593  },
-            {46656,   59719,  46656,   40007,   37324,  58320  },
-            {50653,   63822,  50653,   43808,   40522,  63316  },
-            {54872,   68041,  55969,   47846,   43897,  68590  },
-            {59319,   72369,  60505,   52127,   47455,  74148  },
-            {64000,   76800,  66560,   56660,   51200,  80000  },
-            {68921,   81326,  71677,   61450,   55136,  86151  },
-            {74088,   85942,  78533,   66505,   59270,  92610  },
-            {79507,   90637,  84277,   71833,   63605,  99383  },
-            {85184,   95406,  91998,   77440,   68147,  106480 },
-            {91125,   100237, 98415,   83335,   72900,  113906 },
-            {97336,   105122, 107069,  89523,   77868,  121670 },
-            {103823,  110052, 114205,  96012,   83058,  129778 },
-            {110592,  115015, 123863,  102810,  88473,  138240 },
-            {117649,  120001, 131766,  109923,  94119,  147061 },
-            {125000,  125000, 142500,  117360,  100000, 156250 },
-            {132651,  131324, 151222,  125126,  106120, 165813 },
-            {140608,  137795, 163105,  133229,  112486, 175760 },
-            {148877,  144410, 172697,  141677,  119101, 186096 },
-            {157464,  151165, 185807,  150476,  125971, 196830 },
-            {166375,  158056, 196322,  159635,  133100, 207968 },
-            {175616,  165079, 210739,  169159,  140492, 219520 },
-            {185193,  172229, 222231,  179056,  148154, 231491 },
-            {195112,  179503, 238036,  189334,  156089, 243890 },
-            {205379,  186894, 250562,  199999,  164303, 256723 },
-            {216000,  194400, 267840,  211060,  172800, 270000 },
-            {226981,  202013, 281456,  222522,  181584, 283726 },
-            {238328,  209728, 300293,  234393,  190662, 297910 },
-            {250047,  217540, 315059,  246681,  200037, 312558 },
-            {262144,  225443, 335544,  259392,  209715, 327680 },
-            {274625,  233431, 351520,  272535,  219700, 343281 },
-            {287496,  241496, 373744,  286115,  229996, 359370 },
-            {300763,  249633, 390991,  300140,  240610, 375953 },
-            {314432,  257834, 415050,  314618,  251545, 393040 },
-            {328509,  267406, 433631,  329555,  262807, 410636 },
-            {343000,  276458, 459620,  344960,  274400, 428750 },
-            {357911,  286328, 479600,  360838,  286328, 447388 },
-            {373248,  296358, 507617,  377197,  298598, 466560 },
-            {389017,  305767, 529063,  394045,  311213, 486271 },
-            {405224,  316074, 559209,  411388,  324179, 506530 },
-            {421875,  326531, 582187,  429235,  337500, 527343 },
-            {438976,  336255, 614566,  447591,  351180, 548720 },
-            {456533,  346965, 639146,  466464,  365226, 570666 },
-            {474552,  357812, 673863,  485862,  379641, 593190 },
-            {493039,  367807, 700115,  505791,  394431, 616298 },
-            {512000,  378880, 737280,  526260,  409600, 640000 },
-            {531441,  390077, 765275,  547274,  425152, 664301 },
-            {551368,  400293, 804997,  568841,  441094, 689210 },
-            {571787,  411686, 834809,  590969,  457429, 714733 },
-            {592704,  423190, 877201,  613664,  474163, 740880 },
-            {614125,  433572, 908905,  636935,  491300, 767656 },
-            {636056,  445239, 954084,  660787,  508844, 795070 },
-            {658503,  457001, 987754,  685228,  526802, 823128 },
-            {681472,  467489, 1035837, 710266,  545177, 851840 },
-            {704969,  479378, 1071552, 735907,  563975, 881211 },
-            {729000,  491346, 1122660, 762160,  583200, 911250 },
-            {753571,  501878, 1160499, 789030,  602856, 941963 },
-            {778688,  513934, 1214753, 816525,  622950, 973360 },
-            {804357,  526049, 1254796, 844653,  643485, 1005446},
-            {830584,  536557, 1312322, 873420,  664467, 1038230},
-            {857375,  548720, 1354652, 902835,  685900, 1071718},
-            {884736,  560922, 1415577, 932903,  707788, 1105920},
-            {912673,  571333, 1460276, 963632,  730138, 1140841},
-            {941192,  583539, 1524731, 995030,  752953, 1176490},
-            {970299,  591882, 1571884, 1027103, 776239, 1212873},
-            {1000000, 600000, 1640000, 1059860, 800000, 1250000}
-        };
+        return expCurves[col][row];
+    }
+
+    u8 PKX::levelFromExperience(u32 experience, u8 expType)
+    {
+        // Level 1 needs no experience, and each further threshold reached adds one
+        const auto& curve = expCurves[expType];
+        return 1 + (std::upper_bound(curve.begin() + 1, curve.end(), experience) -
+                       (curve.begin() + 1));
+    }
 
-        return table[row][col];
+    void PKX::levelsFromExperience(
+        std::span<const u32> experience, std::span<const u8> expTypes, std::span<u8> out)
+    {
+        for (size_t i = 0; i < out.size(); i++)
+        {
+            out[i] = levelFromExperience(experience[i], expTypes[i]);
+        }
+    }
+
+    void PKX::stats(std::span<const PKX* const> pks, std::span<std::array<u16, 6>> out)
+    {
+        const size_t count = std::min(pks.size(), out.size());
+        StatColumns columns(count);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            pksm::visit(
+                [&](const auto& pk)
+                {
+                    using PkType = std::remove_cvref_t<decltype(pk)>;
+                    constexpr bool gameBoy =
+                        std::is_same_v<PkType, PK1> || std::is_same_v<PkType, PK2>;
+                    // Gen I has one Special stat, which statImpl reports for both
+                    const u8 base[6] = {pk.baseHP(), pk.baseAtk(), pk.baseDef(), pk.baseSpe(),
+                        pk.baseSpa(), std::is_same_v<PkType, PK1> ? pk.baseSpa() : pk.baseSpd()};
+
+                    columns.level[i] = pk.level();
+                    // Gen I/II have no natures, and Hardy changes no stat
+                    columns.nature[i]   = gameBoy ? u8(Nature::Hardy) : u8(pk.nature());
+                    columns.shedinja[i] = pk.species() == Species::Shedinja;
+                    for (size_t stat = 0; stat < 6; stat++)
+                    {
+                        columns.base[stat][i] = base[stat];
+                        if constexpr (gameBoy)
+                        {
+                            // IVs count twice, and stat experience by its square root
+                            columns.iv[stat][i] = 2 * pk.iv(Stat(stat));
+                            columns.ev[stat][i] =
+                                std::min(255, int(std::ceil(std::sqrt(pk.ev(Stat(stat)))))) >> 2;
+                        }
+                        else
+                        {
+                            columns.iv[stat][i] = pk.iv(Stat(stat));
+                            if constexpr (std::is_same_v<PkType, PK7> ||
+                                          std::is_same_v<PkType, PB7> ||
+                                          std::is_same_v<PkType, PK8>)
+                            {
+                                if (pk.hyperTrain(Stat(stat)))
+                                {
+                                    columns.iv[stat][i] = 31;
+                                }
+                            }
+                            columns.ev[stat][i] = pk.ev(Stat(stat)) / 4;
+                        }
+                        if constexpr (std::is_same_v<PkType, PB7>)
+                        {
+                            columns.bonus[stat][i] = pk.awakened(Stat(stat));
+                        }
+                    }
+                },
+                *pks[i]);
+        }
+
+        std::vector<u16> column(count);
+        for (u8 stat = 0; stat < 6; stat++)
+        {
+            // HP gets 100 more before scaling by level and 10 rather than 5 after it, which is
+            // also what adding the level and 5 more comes to in Gen I/II
+            const u16 flat   = stat == u8(Stat::HP) ? 100 : 0;
+            const u16 offset = stat == u8(Stat::HP) ? 10 : 5;
+            for (size_t i = 0; i < count; i++)
+            {
+                const u32 calc = (2 * columns.base[stat][i] + columns.iv[stat][i] +
+                                     columns.ev[stat][i] + flat) *
+                                     columns.level[i] / 100 +
+                                 offset;
+                const u32 mult = 10 + (columns.nature[i] / 5 + 1 == stat) -
+                                 (columns.nature[i] % 5 + 1 == stat);
+                column[i] = calc * mult / 10 + columns.bonus[stat][i];
+            }
+            for (size_t i = 0; i < count; i++)
+            {
+                out[i][stat] = column[i];
+            }
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (columns.shedinja[i])
+            {
+                out[i][size_t(Stat::HP)] = 1;
+            }
+        }
+    }
+
+    void PKX::updatePartyData(std::span<PKX* const> pks)
+    {
+        std::vector<std::array<u16, 6>> calculated(pks.size());
+        stats(std::span<const PKX* const>(pks.data(), pks.size()), calculated);
+
+        for (size_t i = 0; i < pks.size(); i++)
+        {
+            pksm::visit(
+                [&](auto& pk)
+                {
+                    using PkType = std::remove_cvref_t<decltype(pk)>;
+                    // Gen I stores Special once, so it has no separate SPDEF to write
+                    constexpr size_t partyStats = std::is_same_v<PkType, PK1> ? 5 : 6;
+                    for (size_t stat = 0; stat < partyStats; stat++)
+                    {
+                        pk.partyStat(Stat(stat), calculated[i][stat]);
+                    }
+                    pk.partyLevel(pk.level());
+                    pk.partyCurrHP(calculated[i][size_t(Stat::HP)]);
+                    if constexpr (std::is_same_v<PkType, PB7>)
+                    {
+                        pk.partyCP(pk.CP());
+                    }
+                },
+                *pks[i]);
+        }
     }
 
     void PKX::reorderMoves(void)
@@ -563,6 +740,34 @@ namespace pksm
         return nullptr;
     }
 
+    PKXArena::Ptr<PKX> PKX::getPKM(PKXArena& arena, Generation gen, u8* data, size_t length)
+    {
+        switch (gen)
+        {
+            case Generation::ONE:
+                return getPKM<Generation::ONE>(arena, data, length);
+            case Generation::TWO:
+                return getPKM<Generation::TWO>(arena, data, length);
+            case Generation::THREE:
+                return getPKM<Generation::THREE>(arena, data, length);
+            case Generation::FOUR:
+                return getPKM<Generation::FOUR>(arena, data, length);
+            case Generation::FIVE:
+                return getPKM<Generation::FIVE>(arena, data, length);
+            case Generation::SIX:
+                return getPKM<Generation::SIX>(arena, data, length);
+            case Generation::SEVEN:
+                return getPKM<Generation::SEVEN>(arena, data, length);
+            case Generation::LGPE:
+                return getPKM<Generation::LGPE>(arena, data, length);
+            case Generation::EIGHT:
+                return getPKM<Generation::EIGHT>(arena, data, length);
+            case Generation::UNUSED:
+                return nullptr;
+        }
+        return nullptr;
+    }
+
     bool PKX::operator==(const PKFilter& filter) const
     {
         if (filter.generationEnabled() &&
@@ -715,6 +920,35 @@ namespace pksm
                  : nullptr;
     }
 
+    size_t PKX::partyLength(void) const
+    {
+        switch (generation())
+        {
+            case Generation::ONE:
+                return (language() == Language::JPN ? PK1::JP_LENGTH_WITH_NAMES
+                                                    : PK1::INT_LENGTH_WITH_NAMES);
+            case Generation::TWO:
+                return (language() == Language::JPN ? PK2::JP_LENGTH_WITH_NAMES
+                                                    : PK2::INT_LENGTH_WITH_NAMES);
+            case Generation::THREE:
+                return PK3::PARTY_LENGTH;
+            case Generation::FOUR:
+                return PK4::PARTY_LENGTH;
+            case Generation::FIVE:
+                return PK5::PARTY_LENGTH;
+            case Generation::SIX:
+                return PK6::PARTY_LENGTH;
+            case Generation::SEVEN:
+                return PK7::PARTY_LENGTH;
+            case Generation::LGPE:
+                return PB7::PARTY_LENGTH;
+            case Generation::EIGHT:
+                return PK8::PARTY_LENGTH;
+            default:
+                return 0;
+        }
+    }
+
     std::unique_ptr<PKX> PKX::partyClone() const
     {
         if (isParty())
@@ -724,48 +958,37 @@ namespace pksm
         }
         else
         {
-            size_t partylen;
-            switch (generation())
-            {
-                case Generation::ONE:
-                    partylen = (language() == Language::JPN ? PK1::JP_LENGTH_WITH_NAMES
-                                                            : PK1::INT_LENGTH_WITH_NAMES);
-                    break;
-                case Generation::TWO:
-                    partylen = (language() == Language::JPN ? PK2::JP_LENGTH_WITH_NAMES
-                                                            : PK2::INT_LENGTH_WITH_NAMES);
-                    break;
-                case Generation::THREE:
-                    partylen = PK3::PARTY_LENGTH;
-                    break;
-                case Generation::FOUR:
-                    partylen = PK4::PARTY_LENGTH;
-                    break;
-                case Generation::FIVE:
-                    partylen = PK5::PARTY_LENGTH;
-                    break;
-                case Generation::SIX:
-                    partylen = PK6::PARTY_LENGTH;
-                    break;
-                case Generation::SEVEN:
-                    partylen = PK7::PARTY_LENGTH;
-                    break;
-                case Generation::LGPE:
-                    partylen = PB7::PARTY_LENGTH;
-                    break;
-                case Generation::EIGHT:
-                    partylen = PK8::PARTY_LENGTH;
-                    break;
-                default:
-                    partylen = 0;
-            }
-            auto ret = PKX::getPKM(generation(), nullptr, partylen);
+            auto ret = PKX::getPKM(generation(), nullptr, partyLength());
             std::copy(data, data + getLength(), ret->rawData().data());
             ret->updatePartyData();
             return ret;
         }
     }
 
+    PKXArena::Ptr<PKX> PKX::clone(PKXArena& arena) const
+    {
+        if (generation() == Generation::THREE)
+        {
+            // Same as PK3::clone, which can't use the data constructor
+            auto ret = PKX::getPKM(arena, generation(), nullptr, getLength());
+            std::copy(data, data + getLength(), ret->rawData().data());
+            return ret;
+        }
+        return PKX::getPKM(arena, generation(), const_cast<u8*>(data), getLength());
+    }
+
+    PKXArena::Ptr<PKX> PKX::partyClone(PKXArena& arena) const
+    {
+        if (isParty())
+        {
+            return clone(arena);
+        }
+        auto ret = PKX::getPKM(arena, generation(), nullptr, partyLength());
+        std::copy(data, data + getLength(), ret->rawData().data());
+        ret->updatePartyData();
+        return ret;
+    }
+
     u8 PKX::maxPP(u8 which) const
     {
         return VersionTables::movePP(generation(), move(which), PPUp(which));
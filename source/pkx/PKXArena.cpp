@@ -0,0 +1,57 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62, Pk11
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "pkx/PKXArena.hpp"
+#include <algorithm>
+
+namespace pksm
+{
+    void* PKXArena::allocate(size_t size, size_t alignment)
+    {
+        for (; current < chunks.size(); current++, used = 0)
+        {
+            void* ret   = chunks[current].memory.get() + used;
+            size_t left = chunks[current].size - used;
+            if (std::align(alignment, size, ret, left))
+            {
+                used = chunks[current].size - left + size;
+                return ret;
+            }
+        }
+
+        // Anything that doesn't fit in a normal chunk gets one of its own
+        size_t newSize = std::max(chunkSize, size + alignment);
+        chunks.emplace_back(Chunk{std::unique_ptr<u8[]>(new u8[newSize]), newSize});
+        used = 0;
+        return allocate(size, alignment);
+    }
+
+    void PKXArena::reset(void)
+    {
+        current = 0;
+        used    = 0;
+    }
+}
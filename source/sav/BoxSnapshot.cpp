@@ -0,0 +1,202 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62, Pk11
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "sav/BoxSnapshot.hpp"
+#include "pkx/PKX.hpp"
+#include "sav/Sav.hpp"
+#include <algorithm>
+
+namespace pksm
+{
+    void BoxSnapshot::resize(size_t size)
+    {
+        speciesData.resize(size);
+        formData.resize(size);
+        levelData.resize(size);
+        experienceData.resize(size);
+        expTypeData.resize(size);
+        for (auto& column : ivData)
+        {
+            column.resize(size);
+        }
+        for (auto& column : evData)
+        {
+            column.resize(size);
+        }
+        natureData.resize(size);
+        abilityData.resize(size);
+        ballData.resize(size);
+        shinyData.resize(size);
+        tsvData.resize(size);
+        for (auto& column : moveData)
+        {
+            column.resize(size);
+        }
+        heldItemData.resize(size);
+    }
+
+    void BoxSnapshot::store(size_t index, const PKX& pk)
+    {
+        speciesData[index]    = pk.species();
+        formData[index]       = pk.alternativeForm();
+        experienceData[index] = pk.experience();
+        expTypeData[index]    = pk.expType();
+        for (size_t stat = 0; stat < 6; stat++)
+        {
+            ivData[stat][index] = pk.iv(Stat(stat));
+            evData[stat][index] = pk.ev(Stat(stat));
+        }
+        natureData[index]  = pk.nature();
+        abilityData[index] = pk.ability();
+        ballData[index]    = pk.ball();
+        shinyData[index]   = pk.shiny() ? 1 : 0;
+        tsvData[index]     = pk.TSV();
+        for (u8 move = 0; move < 4; move++)
+        {
+            moveData[move][index] = pk.move(move);
+        }
+        heldItemData[index] = pk.heldItem();
+    }
+
+    void BoxSnapshot::updateLevels(size_t first, size_t count)
+    {
+        PKX::levelsFromExperience(std::span{experienceData}.subspan(first, count),
+            std::span{expTypeData}.subspan(first, count),
+            std::span{levelData}.subspan(first, count));
+    }
+
+    void BoxSnapshot::refresh(const Sav& save)
+    {
+        // Gen I/II boxes hold fewer than 30, but slots are still addressed as box * 30 + slot
+        boxSlotCount = save.generation() <= Generation::TWO ? save.maxBoxes() * 30 : save.maxSlot();
+        resize(boxSlotCount + save.partyCount());
+        for (size_t i = 0; i < boxSlotCount; i++)
+        {
+            store(i, *save.pkm(i / 30, i % 30));
+        }
+        for (u8 slot = 0; slot < save.partyCount(); slot++)
+        {
+            store(partyIndex(slot), *save.pkm(slot));
+        }
+        updateLevels(0, size());
+    }
+
+    void BoxSnapshot::refresh(const Sav& save, u8 box, u8 slot)
+    {
+        store(index(box, slot), *save.pkm(box, slot));
+        updateLevels(index(box, slot), 1);
+    }
+
+    void BoxSnapshot::refreshParty(const Sav& save, u8 slot)
+    {
+        if (partySlots() != save.partyCount())
+        {
+            resize(boxSlotCount + save.partyCount());
+            for (u8 i = 0; i < save.partyCount(); i++)
+            {
+                store(partyIndex(i), *save.pkm(i));
+            }
+            updateLevels(boxSlotCount, partySlots());
+        }
+        else if (slot < partySlots())
+        {
+            store(partyIndex(slot), *save.pkm(slot));
+            updateLevels(partyIndex(slot), 1);
+        }
+    }
+
+    size_t BoxSnapshot::count(Species species) const
+    {
+        return std::count(speciesData.begin(), speciesData.end(), species);
+    }
+
+    size_t BoxSnapshot::shinyCount(void) const
+    {
+        size_t ret = 0;
+        for (size_t i = 0; i < size(); i++)
+        {
+            ret += shinyData[i] & (speciesData[i] != Species::None);
+        }
+        return ret;
+    }
+
+    size_t BoxSnapshot::heldItemCount(u16 item) const
+    {
+        return std::count(heldItemData.begin(), heldItemData.end(), item);
+    }
+
+    size_t BoxSnapshot::knowsMoveCount(Move move) const
+    {
+        size_t ret = 0;
+        for (size_t i = 0; i < size(); i++)
+        {
+            ret += (moveData[0][i] == move) | (moveData[1][i] == move) |
+                   (moveData[2][i] == move) | (moveData[3][i] == move);
+        }
+        return ret;
+    }
+
+    std::vector<u16> BoxSnapshot::ivTotals(void) const
+    {
+        std::vector<u16> ret(size(), 0);
+        for (const auto& column : ivData)
+        {
+            for (size_t i = 0; i < ret.size(); i++)
+            {
+                ret[i] += column[i];
+            }
+        }
+        return ret;
+    }
+
+    std::vector<u16> BoxSnapshot::evTotals(void) const
+    {
+        std::vector<u16> ret(size(), 0);
+        for (const auto& column : evData)
+        {
+            for (size_t i = 0; i < ret.size(); i++)
+            {
+                ret[i] += column[i];
+            }
+        }
+        return ret;
+    }
+
+    std::vector<u32> BoxSnapshot::speciesHistogram(void) const
+    {
+        u16 max = 0;
+        for (Species species : speciesData)
+        {
+            max = std::max(max, u16(species));
+        }
+        std::vector<u32> ret(size() == 0 ? 0 : max + 1, 0);
+        for (Species species : speciesData)
+        {
+            ret[u16(species)]++;
+        }
+        return ret;
+    }
+}
@@ -34,6 +34,7 @@
 #include "pkx/PK6.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKVariant.hpp"
 #include "pkx/PKX.hpp"
 #include "sav/Sav1.hpp"
 #include "sav/Sav2.hpp"
@@ -54,6 +55,81 @@
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/ValueConverter.hpp"
+#include <algorithm>
+
+namespace
+{
+    // Box length of gen's format if Pokémon can be converted to it in place, otherwise 0
+    size_t inPlaceLength(pksm::Generation gen)
+    {
+        switch (gen)
+        {
+            case pksm::Generation::FOUR:
+                return pksm::PK4::BOX_LENGTH;
+            case pksm::Generation::FIVE:
+                return pksm::PK5::BOX_LENGTH;
+            case pksm::Generation::SIX:
+                return pksm::PK6::BOX_LENGTH;
+            case pksm::Generation::SEVEN:
+                return pksm::PK7::BOX_LENGTH;
+            case pksm::Generation::EIGHT:
+                return pksm::PK8::BOX_LENGTH;
+            default:
+                return 0;
+        }
+    }
+
+    // Writes pk converted to gen into out if its format has a conversion that does so
+    bool convertInPlace(const pksm::PKX& pk, pksm::Generation gen, pksm::Sav& save, u8* out)
+    {
+        return pksm::visit(
+            [&](const auto& source)
+            {
+                switch (gen)
+                {
+                    case pksm::Generation::FOUR:
+                        if constexpr (requires { source.convertToG4(save, out); })
+                        {
+                            source.convertToG4(save, out);
+                            return true;
+                        }
+                        break;
+                    case pksm::Generation::FIVE:
+                        if constexpr (requires { source.convertToG5(save, out); })
+                        {
+                            source.convertToG5(save, out);
+                            return true;
+                        }
+                        break;
+                    case pksm::Generation::SIX:
+                        if constexpr (requires { source.convertToG6(save, out); })
+                        {
+                            source.convertToG6(save, out);
+                            return true;
+                        }
+                        break;
+                    case pksm::Generation::SEVEN:
+                        if constexpr (requires { source.convertToG7(save, out); })
+                        {
+                            source.convertToG7(save, out);
+                            return true;
+                        }
+                        break;
+                    case pksm::Generation::EIGHT:
+                        if constexpr (requires { source.convertToG8(save, out); })
+                        {
+                            source.convertToG8(save, out);
+                            return true;
+                        }
+                        break;
+                    default:
+                        break;
+                }
+                return false;
+            },
+            pk);
+    }
+}
 
 namespace pksm
 {
@@ -273,6 +349,74 @@ namespace pksm
         return nullptr;
     }
 
+    std::vector<Sav::BadTransferReason> Sav::transferBatch(
+        std::span<const PKX* const> pks, u8 box, u8 slot, const TransferOptions& options)
+    {
+        const size_t first = box * 30 + slot;
+        const size_t end   = generation() <= Generation::TWO ? maxBoxes() * 30 : maxSlot();
+        const size_t count = first < end ? std::min(pks.size(), end - first) : 0;
+        const size_t width = inPlaceLength(generation());
+
+        std::vector<BadTransferReason> reasons(count, BadTransferReason::OKAY);
+        // Conversions that can write in place share one buffer; the rest go through transfer
+        std::vector<u8> converted(count * width);
+        std::vector<std::unique_ptr<PKX>> transferred(count);
+
+        parallelFor(count, options.threads,
+            [&](size_t i)
+            {
+                if (!pks[i])
+                {
+                    return;
+                }
+                reasons[i] = invalidTransferReason(*pks[i]);
+                // Pokémon already in the save's format are written as they are
+                if (reasons[i] != BadTransferReason::OKAY || pks[i]->generation() == generation())
+                {
+                    return;
+                }
+                if (width != 0 &&
+                    convertInPlace(*pks[i], generation(), *this, &converted[i * width]))
+                {
+                    return;
+                }
+                if (!(transferred[i] = transfer(*pks[i])))
+                {
+                    reasons[i] = BadTransferReason::CONVERSION;
+                }
+            });
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!pks[i] || reasons[i] != BadTransferReason::OKAY)
+            {
+                continue;
+            }
+            auto write = [&](const PKX& pk)
+            {
+                pkm(pk, (first + i) / 30, (first + i) % 30, options.applyTrade);
+                if (options.registerDex)
+                {
+                    dex(pk);
+                }
+            };
+            if (pks[i]->generation() == generation())
+            {
+                write(*pks[i]);
+            }
+            else if (transferred[i])
+            {
+                write(*transferred[i]);
+            }
+            else
+            {
+                std::visit([&](const auto& view) { write(*view); },
+                    *makeConstPKVariant(generation(), &converted[i * width]));
+            }
+        }
+        return reasons;
+    }
+
     void Sav::fixParty()
     {
         // Poor man's bubble sort-like thing
@@ -297,6 +441,66 @@ namespace pksm
         partyCount(numPkm);
     }
 
+    void Sav::trackChanges(bool enable)
+    {
+        // Nothing is known about what changed before tracking started
+        std::fill(dirtyPages.begin(), dirtyPages.end(), true);
+        trackingChanges = enable;
+    }
+
+    void Sav::markDirty(u32 offset, u32 size)
+    {
+        if (trackingChanges && size > 0)
+        {
+            const u32 end = std::min(offset + size - 1, length - 1) / DIRTY_PAGE_SIZE;
+            for (u32 page = offset / DIRTY_PAGE_SIZE; page <= end; page++)
+            {
+                dirtyPages[page] = true;
+            }
+        }
+    }
+
+    bool Sav::isDirty(u32 offset, u32 size) const
+    {
+        if (!trackingChanges)
+        {
+            return true;
+        }
+        const u32 end = std::min(offset + size - 1, length - 1) / DIRTY_PAGE_SIZE;
+        for (u32 page = offset / DIRTY_PAGE_SIZE; page <= end && size > 0; page++)
+        {
+            if (dirtyPages[page])
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Sav::clearDirty()
+    {
+        if (trackingChanges)
+        {
+            std::fill(dirtyPages.begin(), dirtyPages.end(), false);
+        }
+    }
+
+    void Sav::encryptBoxSlot(PKX& pk, u32 offset, u32 size)
+    {
+        if (trackingChanges)
+        {
+            // Leave the actual fix to encrypt(), which may skip it
+            u16 oldChecksum = pk.checksum();
+            pk.refreshChecksum();
+            if (pk.checksum() != oldChecksum)
+            {
+                markDirty(offset, size);
+                pk.checksum(oldChecksum);
+            }
+        }
+        pk.encrypt();
+    }
+
     u32 Sav::displayTID() const
     {
         switch (generation())
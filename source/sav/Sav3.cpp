@@ -168,7 +168,7 @@ namespace pksm
         {
             int ofs   = ABO() + (i * SIZE_BLOCK);
             int index = blockOrder[i];
-            if (index == -1)
+            if (index == -1 || !isDirty(ofs, chunkLength[index]))
             {
                 continue;
             }
@@ -177,10 +177,12 @@ namespace pksm
         }
 
         // Hall of Fame Checksums
+        if (isDirty(0x1C000, SIZE_BLOCK_USED))
         {
             u16 chk = calculateChecksum({&data[0x1C000], SIZE_BLOCK_USED});
             LittleEndian::convertFrom<u16>(&data[0x1CFF4], chk);
         }
+        if (isDirty(0x1D000, SIZE_BLOCK_USED))
         {
             u16 chk = calculateChecksum({&data[0x1D000], SIZE_BLOCK_USED});
             LittleEndian::convertFrom<u16>(&data[0x1DFF4], chk);
@@ -207,6 +209,7 @@ namespace pksm
 
     void Sav3::TID(u16 v)
     {
+        markDirty(blockOfs[0] + 0xA, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[blockOfs[0] + 0xA], v);
     }
 
@@ -217,6 +220,7 @@ namespace pksm
 
     void Sav3::SID(u16 v)
     {
+        markDirty(blockOfs[0] + 0xC, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[blockOfs[0] + 0xC], v);
     }
 
@@ -236,6 +240,7 @@ namespace pksm
 
     void Sav3::gender(Gender v)
     {
+        markDirty(blockOfs[0] + 8, 1);
         data[blockOfs[0] + 8] = u8(v);
     }
 
@@ -257,6 +262,7 @@ namespace pksm
 
     void Sav3::otName(const std::string_view& v)
     {
+        markDirty(blockOfs[0], japanese ? 5 : 7);
         StringUtils::setString3(
             data.get(), v, blockOfs[0], japanese ? 5 : 7, japanese, japanese ? 5 : 7, 0xFF);
     }
@@ -281,9 +287,11 @@ namespace pksm
         {
             case Game::RS:
             case Game::E:
+                markDirty(blockOfs[1] + 0x0490, sizeof(u32));
                 LittleEndian::convertFrom<u32>(&data[blockOfs[1] + 0x0490], v ^ securityKey());
                 break;
             case Game::FRLG:
+                markDirty(blockOfs[1] + 0x0290, sizeof(u32));
                 LittleEndian::convertFrom<u32>(&data[blockOfs[1] + 0x0290], v ^ securityKey());
                 break;
             default:
@@ -305,6 +313,7 @@ namespace pksm
             v = 9999;
         }
 
+        markDirty(blockOfs[0] + 0xEB8, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[blockOfs[0] + 0xEB8], v);
     }
 
@@ -341,6 +350,7 @@ namespace pksm
             flagNumber -= 0x500;
             start      = blockOfs[2];
         }
+        markDirty(start + (flagNumber >> 3), 1);
         FlagUtil::setFlag(data.get(), start + (flagNumber >> 3), flagNumber & 7, value);
     }
 
@@ -380,6 +390,7 @@ namespace pksm
 
     void Sav3::playedHours(u16 v)
     {
+        markDirty(blockOfs[0] + 0xE, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[blockOfs[0] + 0xE], v);
     }
 
@@ -390,6 +401,7 @@ namespace pksm
 
     void Sav3::playedMinutes(u8 v)
     {
+        markDirty(blockOfs[0] + 0x10, 1);
         data[blockOfs[0] + 0x10] = v;
     }
 
@@ -400,6 +412,7 @@ namespace pksm
 
     void Sav3::playedSeconds(u8 v)
     {
+        markDirty(blockOfs[0] + 0x11, 1);
         data[blockOfs[0] + 0x11] = v;
     }
 
@@ -412,6 +425,7 @@ namespace pksm
 
     void Sav3::currentBox(u8 v)
     {
+        markDirty(blockOfs[5], 1);
         data[blockOfs[5]] = v;
     }
 
@@ -459,6 +473,7 @@ namespace pksm
         {
             auto pk3 = pk.partyClone();
             pk3->encrypt();
+            markDirty(partyOffset(slot), PK3::PARTY_LENGTH);
             std::ranges::copy(pk3->rawData(), &data[partyOffset(slot)]);
         }
     }
@@ -479,13 +494,16 @@ namespace pksm
             {
                 // Copy into the correct positions if so
                 u32 firstSize = 0xF80 - (offset % 0x1000);
+                markDirty(offset, firstSize);
                 std::ranges::copy(pk3->rawData().subspan(0, firstSize), &data[offset]);
                 u32 nextOffset = boxOffset(box + (slot + 1) / 30, (slot + 1) % 30);
+                markDirty(nextOffset & 0xFFFFF000, PK3::BOX_LENGTH - firstSize);
                 std::ranges::copy(pk3->rawData().subspan(firstSize, PK3::BOX_LENGTH - firstSize),
                     &data[nextOffset & 0xFFFFF000]);
             }
             else
             {
+                markDirty(offset, PK3::BOX_LENGTH);
                 std::ranges::copy(pk3->rawData(), &data[offset]);
             }
         }
@@ -523,6 +541,7 @@ namespace pksm
 
     void Sav3::dexPIDUnown(u32 v)
     {
+        markDirty(PokeDex + 0x4, sizeof(u32));
         LittleEndian::convertFrom<u32>(&data[PokeDex + 0x4], v);
     }
 
@@ -533,6 +552,7 @@ namespace pksm
 
     void Sav3::dexPIDSpinda(u32 v)
     {
+        markDirty(PokeDex + 0x8, sizeof(u32));
         LittleEndian::convertFrom<u32>(&data[PokeDex + 0x8], v);
     }
 
@@ -577,6 +597,7 @@ namespace pksm
         int bit          = u16(species) - 1;
         int ofs          = bit >> 3;
         int caughtOffset = PokeDex + 0x10;
+        markDirty(caughtOffset + ofs, 1);
         FlagUtil::setFlag(data.get(), caughtOffset + ofs, bit & 7, caught);
     }
 
@@ -595,6 +616,7 @@ namespace pksm
 
         for (int o : seenFlagOffsets)
         {
+            markDirty(o + ofs, 1);
             FlagUtil::setFlag(data.get(), o + ofs, bit & 7, seen);
         }
     }
@@ -638,7 +660,7 @@ namespace pksm
                 }
                 if (!crypted)
                 {
-                    pk3->encrypt();
+                    encryptBoxSlot(*pk3, offset, PK3::BOX_LENGTH);
                 }
                 if (split)
                 {
@@ -656,6 +678,7 @@ namespace pksm
 
     void Sav3::boxName(u8 box, const std::string_view& v)
     {
+        markDirty(boxOffset(maxBoxes(), 0) + (box * 9), 9);
         return StringUtils::setString3(
             data.get(), v, boxOffset(maxBoxes(), 0) + (box * 9), 8, japanese, 9);
     }
@@ -669,8 +692,9 @@ namespace pksm
 
     void Sav3::boxWallpaper(u8 box, u8 v)
     {
-        int offset   = boxOffset(maxBoxes(), 0);
-        offset       += (maxBoxes() * 0x9) + box;
+        int offset = boxOffset(maxBoxes(), 0);
+        offset     += (maxBoxes() * 0x9) + box;
+        markDirty(offset, 1);
         data[offset] = v;
     }
 
@@ -681,6 +705,7 @@ namespace pksm
 
     void Sav3::partyCount(u8 v)
     {
+        markDirty(blockOfs[1] + (game == Game::FRLG ? 0x34 : 0x234), 1);
         data[blockOfs[1] + (game == Game::FRLG ? 0x34 : 0x234)] = v;
     }
 
@@ -699,21 +724,27 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::NormalItem:
+                markDirty(OFS_PouchHeldItem + (slot * 4), write.size());
                 std::copy(write.begin(), write.end(), &data[OFS_PouchHeldItem + (slot * 4)]);
                 break;
             case Pouch::KeyItem:
+                markDirty(OFS_PouchKeyItem + (slot * 4), write.size());
                 std::copy(write.begin(), write.end(), &data[OFS_PouchKeyItem + (slot * 4)]);
                 break;
             case Pouch::Ball:
+                markDirty(OFS_PouchBalls + (slot * 4), write.size());
                 std::copy(write.begin(), write.end(), &data[OFS_PouchBalls + (slot * 4)]);
                 break;
             case Pouch::TM:
+                markDirty(OFS_PouchTMHM + (slot * 4), write.size());
                 std::copy(write.begin(), write.end(), &data[OFS_PouchTMHM + (slot * 4)]);
                 break;
             case Pouch::Berry:
+                markDirty(OFS_PouchBerry + (slot * 4), write.size());
                 std::copy(write.begin(), write.end(), &data[OFS_PouchBerry + (slot * 4)]);
                 break;
             case Pouch::PCItem:
+                markDirty(OFS_PCItem + (slot * 4), write.size());
                 std::copy(write.begin(), write.end(), &data[OFS_PCItem + (slot * 4)]);
                 break;
             default:
@@ -770,6 +801,7 @@ namespace pksm
         {
             return;
         }
+        markDirty(blockOfs[0] + 0x98, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[blockOfs[0] + 0x98], v);
     }
 
@@ -788,6 +820,7 @@ namespace pksm
         {
             return;
         }
+        markDirty(blockOfs[0] + 0x98 + 2, 1);
         data[blockOfs[0] + 0x98 + 2] = v;
     }
 
@@ -806,6 +839,7 @@ namespace pksm
         {
             return;
         }
+        markDirty(blockOfs[0] + 0x98 + 3, 1);
         data[blockOfs[0] + 0x98 + 3] = v;
     }
 
@@ -824,6 +858,7 @@ namespace pksm
         {
             return;
         }
+        markDirty(blockOfs[0] + 0x98 + 4, 1);
         data[blockOfs[0] + 0x98 + 4] = v;
     }
 
@@ -842,6 +877,7 @@ namespace pksm
         {
             return;
         }
+        markDirty(blockOfs[0] + 0xA0, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[blockOfs[0] + 0xA0], v);
     }
 
@@ -860,6 +896,7 @@ namespace pksm
         {
             return;
         }
+        markDirty(blockOfs[0] + 0xA0 + 2, 1);
         data[blockOfs[0] + 0xA0 + 2] = v;
     }
 
@@ -878,6 +915,7 @@ namespace pksm
         {
             return;
         }
+        markDirty(blockOfs[0] + 0xA0 + 3, 1);
         data[blockOfs[0] + 0xA0 + 3] = v;
     }
 
@@ -896,6 +934,7 @@ namespace pksm
         {
             return;
         }
+        markDirty(blockOfs[0] + 0xA0 + 4, 1);
         data[blockOfs[0] + 0xA0 + 4] = v;
     }
 }
@@ -143,11 +143,19 @@ namespace pksm
             : game == Game::Pt ? 0x1F10E
                                : 0x21A0E};
 
-        cs = pksm::crypto::ccitt16({&data[gbo + general[0]], (size_t)(general[1] - general[0])});
-        LittleEndian::convertFrom<u16>(&data[gbo + general[2]], cs);
+        if (isDirty(gbo + general[0], general[1] - general[0]))
+        {
+            cs = pksm::crypto::ccitt16(
+                {&data[gbo + general[0]], (size_t)(general[1] - general[0])});
+            LittleEndian::convertFrom<u16>(&data[gbo + general[2]], cs);
+        }
 
-        cs = pksm::crypto::ccitt16({&data[sbo + storage[0]], (size_t)(storage[1] - storage[0])});
-        LittleEndian::convertFrom<u16>(&data[sbo + storage[2]], cs);
+        if (isDirty(sbo + storage[0], storage[1] - storage[0]))
+        {
+            cs = pksm::crypto::ccitt16(
+                {&data[sbo + storage[0]], (size_t)(storage[1] - storage[0])});
+            LittleEndian::convertFrom<u16>(&data[sbo + storage[2]], cs);
+        }
     }
 
     u16 Sav4::TID(void) const
@@ -157,6 +165,7 @@ namespace pksm
 
     void Sav4::TID(u16 v)
     {
+        markDirty(Trainer1 + 0x10, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[Trainer1 + 0x10], v);
     }
 
@@ -167,6 +176,7 @@ namespace pksm
 
     void Sav4::SID(u16 v)
     {
+        markDirty(Trainer1 + 0x12, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[Trainer1 + 0x12], v);
     }
 
@@ -186,6 +196,7 @@ namespace pksm
 
     void Sav4::gender(Gender v)
     {
+        markDirty(Trainer1 + 0x18, 1);
         data[Trainer1 + 0x18] = u8(v);
     }
 
@@ -196,6 +207,7 @@ namespace pksm
 
     void Sav4::language(Language v)
     {
+        markDirty(Trainer1 + 0x19, 1);
         data[Trainer1 + 0x19] = u8(v);
     }
 
@@ -206,6 +218,7 @@ namespace pksm
 
     void Sav4::otName(const std::string_view& v)
     {
+        markDirty(Trainer1, 8 * 2);
         StringUtils::setString4(data.get(), StringUtils::transString45(v), Trainer1, 8);
     }
 
@@ -216,6 +229,7 @@ namespace pksm
 
     void Sav4::money(u32 v)
     {
+        markDirty(Trainer1 + 0x14, sizeof(u32));
         LittleEndian::convertFrom<u32>(&data[Trainer1 + 0x14], v);
     }
 
@@ -226,6 +240,7 @@ namespace pksm
 
     void Sav4::BP(u32 v)
     {
+        markDirty(Trainer1 + 0x20, sizeof(u32));
         LittleEndian::convertFrom<u32>(&data[Trainer1 + 0x20], v);
     }
 
@@ -255,6 +270,7 @@ namespace pksm
 
     void Sav4::playedHours(u16 v)
     {
+        markDirty(Trainer1 + 0x22, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[Trainer1 + 0x22], v);
     }
 
@@ -265,6 +281,7 @@ namespace pksm
 
     void Sav4::playedMinutes(u8 v)
     {
+        markDirty(Trainer1 + 0x24, 1);
         data[Trainer1 + 0x24] = v;
     }
 
@@ -275,6 +292,7 @@ namespace pksm
 
     void Sav4::playedSeconds(u8 v)
     {
+        markDirty(Trainer1 + 0x25, 1);
         data[Trainer1 + 0x25] = v;
     }
 
@@ -286,7 +304,8 @@ namespace pksm
 
     void Sav4::currentBox(u8 v)
     {
-        int ofs   = game == Game::HGSS ? boxOffset(maxBoxes(), 0) : Box - 4;
+        int ofs = game == Game::HGSS ? boxOffset(maxBoxes(), 0) : Box - 4;
+        markDirty(ofs, 1);
         data[ofs] = v;
     }
 
@@ -312,10 +331,22 @@ namespace pksm
         {
             auto pk4 = pk.partyClone();
             pk4->encrypt();
+            markDirty(partyOffset(slot), PK4::PARTY_LENGTH);
             std::ranges::copy(pk4->rawData(), &data[partyOffset(slot)]);
         }
     }
 
+    PKView<PK4> Sav4::pkmView(u8 box, u8 slot)
+    {
+        markDirty(boxOffset(box, slot), PK4::BOX_LENGTH);
+        return PKView<PK4>(&data[boxOffset(box, slot)]);
+    }
+
+    ConstPKView<PK4> Sav4::pkmConstView(u8 box, u8 slot) const
+    {
+        return ConstPKView<PK4>(&data[boxOffset(box, slot)]);
+    }
+
     std::unique_ptr<PKX> Sav4::pkm(u8 box, u8 slot) const
     {
         return PKX::getPKM<Generation::FOUR>(&data[boxOffset(box, slot)], PK4::BOX_LENGTH);
@@ -331,6 +362,7 @@ namespace pksm
                 trade(*pkm);
             }
 
+            markDirty(boxOffset(box, slot), PK4::BOX_LENGTH);
             std::ranges::copy(
                 pkm->rawData().subspan(0, PK4::BOX_LENGTH), &data[boxOffset(box, slot)]);
         }
@@ -349,18 +381,8 @@ namespace pksm
 
     void Sav4::cryptBoxData(bool crypted)
     {
-        for (u8 box = 0; box < maxBoxes(); box++)
-        {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                std::unique_ptr<PKX> pk4 = PKX::getPKM<Generation::FOUR>(
-                    &data[boxOffset(box, slot)], PK4::BOX_LENGTH, true);
-                if (!crypted)
-                {
-                    pk4->encrypt();
-                }
-            }
-        }
+        const u32 boxStride = boxOffset(1, 0) - boxOffset(0, 0);
+        cryptBoxSlots<PK4>(&data[boxOffset(0, 0)], boxStride, maxBoxes() * 30, false, crypted);
     }
 
     bool Sav4::giftsMenuActivated(void) const
@@ -370,7 +392,9 @@ namespace pksm
 
     void Sav4::giftsMenuActivated(bool v)
     {
+        markDirty(gbo + 72, 1);
         data[gbo + 72] &= 0xFE;
+        markDirty(gbo + 72, 1);
         data[gbo + 72] |= v ? 1 : 0;
     }
 
@@ -379,7 +403,9 @@ namespace pksm
         if (wc.generation() == Generation::FOUR)
         {
             giftsMenuActivated(true);
+            markDirty(WondercardFlags + (2047 >> 3), 1);
             data[WondercardFlags + (2047 >> 3)] = 0x80;
+            markDirty(WondercardData + pos * PGT::length, PGT::length);
             std::copy(wc.rawData(), wc.rawData() + PGT::length,
                 &data[WondercardData + pos * PGT::length]);
             pos++;
@@ -387,6 +413,7 @@ namespace pksm
             {
                 static constexpr u32 dpSlotActive = 0xEDB88320;
                 const int ofs                     = WondercardFlags + 0x100;
+                markDirty(ofs + 4 * pos, sizeof(u32));
                 LittleEndian::convertFrom<u32>(&data[ofs + 4 * pos], dpSlotActive);
             }
         }
@@ -400,6 +427,7 @@ namespace pksm
 
     void Sav4::boxName(u8 box, const std::string_view& name)
     {
+        markDirty(boxOffset(18, 0) + box * 0x28 + (game == Game::HGSS ? 0x8 : 0), 9 * 2);
         StringUtils::setString4(data.get(), StringUtils::transString45(name),
             boxOffset(18, 0) + box * 0x28 + (game == Game::HGSS ? 0x8 : 0), 9);
     }
@@ -451,6 +479,7 @@ namespace pksm
         {
             return;
         }
+        markDirty(offset, 1);
         data[offset] = v;
     }
 
@@ -461,6 +490,7 @@ namespace pksm
 
     void Sav4::partyCount(u8 v)
     {
+        markDirty(Party - 4, 1);
         data[Party - 4] = v;
     }
 
@@ -488,6 +518,9 @@ namespace pksm
          * (bit1 ^ bit2) + 1 = forms in dex
          * bit2 = male/female shown first toggle */
 
+        // Owned, seen and both gender bytes are all touched below
+        markDirty(ofs, brSize * 3 + 1);
+
         // Set the species() Owned Flag
         data[ofs + brSize * 0] |= mask;
 
@@ -541,6 +574,7 @@ namespace pksm
                         continue; // keep searching
                     }
 
+                    markDirty(formOffset + 4 + i, 1);
                     data[formOffset + 4 + i] = u8(pk.alternativeForm());
                     break; // form now set
                 }
@@ -600,6 +634,7 @@ namespace pksm
             lang = 0; // no KOR+
         }
         lang = (lang < 0) ? 1 : lang; // default English
+        markDirty(languageFlags + (game == Game::DP ? dpl : u16(pk.species())), 1);
         data[languageFlags + (game == Game::DP ? dpl : u16(pk.species()))] |= (u8)(1 << lang);
     }
 
@@ -763,8 +798,10 @@ namespace pksm
         static constexpr u8 brSize = 0x40;
         if (species == Species::Deoxys)
         {
-            u32 newval                           = setDexFormValues(forms, 4, 4);
+            u32 newval = setDexFormValues(forms, 4, 4);
+            markDirty(PokeDex + 0x4 + 1 * brSize - 1, 1);
             data[PokeDex + 0x4 + 1 * brSize - 1] = newval & 0xFF;
+            markDirty(PokeDex + 0x4 + 2 * brSize - 1, 1);
             data[PokeDex + 0x4 + 2 * brSize - 1] = (newval >> 8) & 0xFF;
         }
 
@@ -772,15 +809,19 @@ namespace pksm
         switch (species)
         {
             case Species::Shellos:
+                markDirty(formOffset + 0, 1);
                 data[formOffset + 0] = u8(setDexFormValues(forms, 1, 2));
                 return;
             case Species::Gastrodon:
+                markDirty(formOffset + 1, 1);
                 data[formOffset + 1] = u8(setDexFormValues(forms, 1, 2));
                 return;
             case Species::Burmy:
+                markDirty(formOffset + 2, 1);
                 data[formOffset + 2] = u8(setDexFormValues(forms, 2, 3));
                 return;
             case Species::Wormadam:
+                markDirty(formOffset + 3, 1);
                 data[formOffset + 3] = u8(setDexFormValues(forms, 2, 3));
                 return;
             case Species::Unown:
@@ -792,6 +833,7 @@ namespace pksm
                 {
                     forms[i] = 0xFF;
                 }
+                markDirty(ofs, forms.size());
                 std::copy(forms.begin(), forms.end(), data.get() + ofs);
                 return;
             }
@@ -811,6 +853,7 @@ namespace pksm
             case Species::Rotom:
             {
                 auto values = LittleEndian::convertFrom(setDexFormValues(forms, 3, 6));
+                markDirty(formOffset2, values.size());
                 for (size_t i = 0; i < values.size(); i++)
                 {
                     data[formOffset2 + i] = values[i];
@@ -819,11 +862,13 @@ namespace pksm
             }
             case Species::Shaymin:
             {
+                markDirty(formOffset2 + 4, 1);
                 data[formOffset2 + 4] = (u8)setDexFormValues(forms, 1, 2);
                 return;
             }
             case Species::Giratina:
             {
+                markDirty(formOffset2 + 5, 1);
                 data[formOffset2 + 5] = (u8)setDexFormValues(forms, 1, 2);
                 return;
             }
@@ -831,6 +876,7 @@ namespace pksm
             {
                 if (game == Game::HGSS)
                 {
+                    markDirty(formOffset2 + 6, 1);
                     data[formOffset2 + 6] = (u8)setDexFormValues(forms, 2, 3);
                     return;
                 }
@@ -897,27 +943,35 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::NormalItem:
+                markDirty(PouchHeldItem + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
                 break;
             case Pouch::KeyItem:
+                markDirty(PouchKeyItem + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
                 break;
             case Pouch::TM:
+                markDirty(PouchTMHM + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
                 break;
             case Pouch::Mail:
+                markDirty(MailItems + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[MailItems + slot * 4]);
                 break;
             case Pouch::Medicine:
+                markDirty(PouchMedicine + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
                 break;
             case Pouch::Berry:
+                markDirty(PouchBerry + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
                 break;
             case Pouch::Ball:
+                markDirty(PouchBalls + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchBalls + slot * 4]);
                 break;
             case Pouch::Battle:
+                markDirty(BattleItems + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[BattleItems + slot * 4]);
                 break;
             default:
@@ -41,6 +41,7 @@ namespace pksm
 
     void Sav5::TID(u16 v)
     {
+        markDirty(Trainer1 + 0x14, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[Trainer1 + 0x14], v);
     }
 
@@ -51,6 +52,7 @@ namespace pksm
 
     void Sav5::SID(u16 v)
     {
+        markDirty(Trainer1 + 0x16, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[Trainer1 + 0x16], v);
     }
 
@@ -61,6 +63,7 @@ namespace pksm
 
     void Sav5::version(GameVersion v)
     {
+        markDirty(Trainer1 + 0x1F, 1);
         data[Trainer1 + 0x1F] = u8(v);
     }
 
@@ -71,6 +74,7 @@ namespace pksm
 
     void Sav5::gender(Gender v)
     {
+        markDirty(Trainer1 + 0x21, 1);
         data[Trainer1 + 0x21] = u8(v);
     }
 
@@ -81,6 +85,7 @@ namespace pksm
 
     void Sav5::language(Language v)
     {
+        markDirty(Trainer1 + 0x1E, 1);
         data[Trainer1 + 0x1E] = u8(v);
     }
 
@@ -92,6 +97,7 @@ namespace pksm
 
     void Sav5::otName(const std::string_view& v)
     {
+        markDirty(Trainer1 + 0x4, 8 * 2);
         StringUtils::setString(
             data.get(), StringUtils::transString45(v), Trainer1 + 0x4, 8, u'\uFFFF', 0);
     }
@@ -103,6 +109,7 @@ namespace pksm
 
     void Sav5::money(u32 v)
     {
+        markDirty(Trainer2, sizeof(u32));
         LittleEndian::convertFrom<u32>(&data[Trainer2], v);
     }
 
@@ -113,6 +120,7 @@ namespace pksm
 
     void Sav5::BP(u32 v)
     {
+        markDirty(BattleSubway, sizeof(u32));
         LittleEndian::convertFrom<u32>(&data[BattleSubway], v);
     }
 
@@ -134,6 +142,7 @@ namespace pksm
 
     void Sav5::playedHours(u16 v)
     {
+        markDirty(Trainer1 + 0x24, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[Trainer1 + 0x24], v);
     }
 
@@ -144,6 +153,7 @@ namespace pksm
 
     void Sav5::playedMinutes(u8 v)
     {
+        markDirty(Trainer1 + 0x26, 1);
         data[Trainer1 + 0x26] = v;
     }
 
@@ -154,6 +164,7 @@ namespace pksm
 
     void Sav5::playedSeconds(u8 v)
     {
+        markDirty(Trainer1 + 0x27, 1);
         data[Trainer1 + 0x27] = v;
     }
 
@@ -164,6 +175,7 @@ namespace pksm
 
     void Sav5::currentBox(u8 v)
     {
+        markDirty(PCLayout, 1);
         data[PCLayout] = v;
     }
 
@@ -174,6 +186,7 @@ namespace pksm
 
     void Sav5::unlockedBoxes(u8 v)
     {
+        markDirty(PCLayout + 0x3DD, 1);
         data[PCLayout + 0x3DD] = v;
     }
 
@@ -198,10 +211,22 @@ namespace pksm
         {
             auto pk5 = pk.partyClone();
             pk5->encrypt();
+            markDirty(partyOffset(slot), PK5::PARTY_LENGTH);
             std::ranges::copy(pk5->rawData(), &data[partyOffset(slot)]);
         }
     }
 
+    PKView<PK5> Sav5::pkmView(u8 box, u8 slot)
+    {
+        markDirty(boxOffset(box, slot), PK5::BOX_LENGTH);
+        return PKView<PK5>(&data[boxOffset(box, slot)]);
+    }
+
+    ConstPKView<PK5> Sav5::pkmConstView(u8 box, u8 slot) const
+    {
+        return ConstPKView<PK5>(&data[boxOffset(box, slot)]);
+    }
+
     std::unique_ptr<PKX> Sav5::pkm(u8 box, u8 slot) const
     {
         return PKX::getPKM<Generation::FIVE>(&data[boxOffset(box, slot)], PK5::BOX_LENGTH);
@@ -217,6 +242,7 @@ namespace pksm
                 trade(*pk5);
             }
 
+            markDirty(boxOffset(box, slot), PK5::BOX_LENGTH);
             std::ranges::copy(
                 pk5->rawData().subspan(0, PK5::BOX_LENGTH), &data[boxOffset(box, slot)]);
         }
@@ -235,18 +261,8 @@ namespace pksm
 
     void Sav5::cryptBoxData(bool crypted)
     {
-        for (u8 box = 0; box < maxBoxes(); box++)
-        {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                std::unique_ptr<PKX> pk5 = PKX::getPKM<Generation::FIVE>(
-                    &data[boxOffset(box, slot)], PK5::BOX_LENGTH, true);
-                if (!crypted)
-                {
-                    pk5->encrypt();
-                }
-            }
-        }
+        const u32 boxStride = boxOffset(1, 0) - boxOffset(0, 0);
+        cryptBoxSlots<PK5>(&data[boxOffset(0, 0)], boxStride, maxBoxes() * 30, false, crypted);
     }
 
     int Sav5::dexFormIndex(int species, int formct) const
@@ -328,9 +344,11 @@ namespace pksm
         int ofs          = PokeDex + 0x8 + (bit >> 3);
 
         // Set the Species Owned Flag
+        markDirty(ofs + brSize * 0, 1);
         data[ofs + brSize * 0] |= (1 << (bit % 8));
 
         // Set the [Species/Gender/Shiny] Seen Flag
+        markDirty(PokeDex + 0x8 + shiftoff + bit / 8, 1);
         data[PokeDex + 0x8 + shiftoff + bit / 8] |= (1 << (bit & 7));
 
         // Set the Display flag if none are set
@@ -342,6 +360,7 @@ namespace pksm
         if (!displayed)
         { // offset is already biased by brSize, reuse shiftoff but for the display
           // flags.
+            markDirty(ofs + brSize * (shift + 4), 1);
             data[ofs + brSize * (shift + 4)] |= (1 << (bit & 7));
         }
 
@@ -357,6 +376,7 @@ namespace pksm
             {
                 lang = 1;
             }
+            markDirty(PokeDexLanguageFlags + ((bit * 7 + lang) >> 3), 1);
             data[PokeDexLanguageFlags + ((bit * 7 + lang) >> 3)] |= (1 << ((bit * 7 + lang) & 7));
         }
 
@@ -373,6 +393,7 @@ namespace pksm
         bit         = f + pk.alternativeForm();
 
         // Set Form Seen Flag
+        markDirty(formDex + formLen * shiny + (bit >> 3), 1);
         data[formDex + formLen * shiny + (bit >> 3)] |= (1 << (bit & 7));
 
         // Set displayed Flag if necessary, check all flags
@@ -388,7 +409,8 @@ namespace pksm
                 return; // already set
             }
         }
-        bit                                                = f + pk.alternativeForm();
+        bit = f + pk.alternativeForm();
+        markDirty(formDex + formLen * (2 + shiny) + (bit >> 3), 1);
         data[formDex + formLen * (2 + shiny) + (bit >> 3)] |= (1 << (bit & 7));
     }
 
@@ -432,7 +454,9 @@ namespace pksm
     {
         if (wc.generation() == Generation::FIVE)
         {
+            markDirty(WondercardFlags + (wc.ID() / 8), 1);
             data[WondercardFlags + (wc.ID() / 8)] |= 0x1 << (wc.ID() & 7);
+            markDirty(WondercardData + pos * PGF::length, PGF::length);
             std::copy(wc.rawData(), wc.rawData() + PGF::length,
                 &data[WondercardData + pos * PGF::length]);
             pos = (pos + 1) % 12;
@@ -447,6 +471,7 @@ namespace pksm
 
     void Sav5::boxName(u8 box, const std::string_view& name)
     {
+        markDirty(PCLayout + 0x28 * box + 4, 9 * 2);
         StringUtils::setString(data.get(), StringUtils::transString45(name),
             PCLayout + 0x28 * box + 4, 9, u'\uFFFF', 0);
     }
@@ -458,6 +483,7 @@ namespace pksm
 
     void Sav5::boxWallpaper(u8 box, u8 v)
     {
+        markDirty(PCLayout + 0x3C4 + box, 1);
         data[PCLayout + 0x3C4 + box] = v;
     }
 
@@ -468,6 +494,7 @@ namespace pksm
 
     void Sav5::partyCount(u8 v)
     {
+        markDirty(Party + 4, 1);
         data[Party + 4] = v;
     }
 
@@ -504,6 +531,7 @@ namespace pksm
     void Sav5::cryptMysteryGiftData()
     {
         u32 seed = LittleEndian::convertTo<u32>(&data[0x1D290]);
+        markDirty(WondercardFlags, 0xA90);
         pksm::crypto::pkm::crypt<0xA90>(&data[WondercardFlags], seed);
     }
 
@@ -519,18 +547,23 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::NormalItem:
+                markDirty(PouchHeldItem + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
                 break;
             case Pouch::KeyItem:
+                markDirty(PouchKeyItem + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
                 break;
             case Pouch::TM:
+                markDirty(PouchTMHM + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
                 break;
             case Pouch::Medicine:
+                markDirty(PouchMedicine + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
                 break;
             case Pouch::Berry:
+                markDirty(PouchBerry + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
                 break;
             default:
@@ -41,6 +41,7 @@ namespace pksm
 
     void Sav6::TID(u16 v)
     {
+        markDirty(TrainerCard, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[TrainerCard], v);
     }
 
@@ -51,6 +52,7 @@ namespace pksm
 
     void Sav6::SID(u16 v)
     {
+        markDirty(TrainerCard + 2, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[TrainerCard + 2], v);
     }
 
@@ -61,6 +63,7 @@ namespace pksm
 
     void Sav6::version(GameVersion v)
     {
+        markDirty(TrainerCard + 4, 1);
         data[TrainerCard + 4] = u8(v);
     }
 
@@ -71,6 +74,7 @@ namespace pksm
 
     void Sav6::gender(Gender v)
     {
+        markDirty(TrainerCard + 5, 1);
         data[TrainerCard + 5] = u8(v);
     }
 
@@ -81,6 +85,7 @@ namespace pksm
 
     void Sav6::subRegion(u8 v)
     {
+        markDirty(TrainerCard + 0x26, 1);
         data[TrainerCard + 0x26] = v;
     }
 
@@ -91,6 +96,7 @@ namespace pksm
 
     void Sav6::country(u8 v)
     {
+        markDirty(TrainerCard + 0x27, 1);
         data[TrainerCard + 0x27] = v;
     }
 
@@ -101,6 +107,7 @@ namespace pksm
 
     void Sav6::consoleRegion(u8 v)
     {
+        markDirty(TrainerCard + 0x2C, 1);
         data[TrainerCard + 0x2C] = v;
     }
 
@@ -111,6 +118,7 @@ namespace pksm
 
     void Sav6::language(Language v)
     {
+        markDirty(TrainerCard + 0x2D, 1);
         data[TrainerCard + 0x2D] = u8(v);
     }
 
@@ -122,6 +130,7 @@ namespace pksm
 
     void Sav6::otName(const std::string_view& v)
     {
+        markDirty(TrainerCard + 0x48, 13 * 2);
         StringUtils::setString(data.get(), StringUtils::transString67(v), TrainerCard + 0x48, 13);
     }
 
@@ -132,6 +141,7 @@ namespace pksm
 
     void Sav6::money(u32 v)
     {
+        markDirty(Trainer2 + 0x8, sizeof(u32));
         LittleEndian::convertFrom<u32>(&data[Trainer2 + 0x8], v);
     }
 
@@ -142,6 +152,7 @@ namespace pksm
 
     void Sav6::BP(u32 v)
     {
+        markDirty(Trainer2 + (game == Game::XY ? 0x3C : 0x30), sizeof(u32));
         LittleEndian::convertFrom<u32>(&data[Trainer2 + (game == Game::XY ? 0x3C : 0x30)], v);
     }
 
@@ -163,6 +174,7 @@ namespace pksm
 
     void Sav6::playedHours(u16 v)
     {
+        markDirty(PlayTime, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[PlayTime], v);
     }
 
@@ -173,6 +185,7 @@ namespace pksm
 
     void Sav6::playedMinutes(u8 v)
     {
+        markDirty(PlayTime + 2, 1);
         data[PlayTime + 2] = v;
     }
 
@@ -183,6 +196,7 @@ namespace pksm
 
     void Sav6::playedSeconds(u8 v)
     {
+        markDirty(PlayTime + 3, 1);
         data[PlayTime + 3] = v;
     }
 
@@ -193,6 +207,7 @@ namespace pksm
 
     void Sav6::currentBox(u8 v)
     {
+        markDirty(LastViewedBox, 1);
         data[LastViewedBox] = v;
     }
 
@@ -203,6 +218,7 @@ namespace pksm
 
     void Sav6::unlockedBoxes(u8 v)
     {
+        markDirty(LastViewedBox - 1, 1);
         data[LastViewedBox - 1] = v;
     }
 
@@ -227,10 +243,22 @@ namespace pksm
         {
             auto pk6 = pk.partyClone();
             pk6->encrypt();
+            markDirty(partyOffset(slot), PK6::PARTY_LENGTH);
             std::ranges::copy(pk6->rawData(), &data[partyOffset(slot)]);
         }
     }
 
+    PKView<PK6> Sav6::pkmView(u8 box, u8 slot)
+    {
+        markDirty(boxOffset(box, slot), PK6::BOX_LENGTH);
+        return PKView<PK6>(&data[boxOffset(box, slot)]);
+    }
+
+    ConstPKView<PK6> Sav6::pkmConstView(u8 box, u8 slot) const
+    {
+        return ConstPKView<PK6>(&data[boxOffset(box, slot)]);
+    }
+
     std::unique_ptr<PKX> Sav6::pkm(u8 box, u8 slot) const
     {
         return PKX::getPKM<Generation::SIX>(&data[boxOffset(box, slot)], PK6::BOX_LENGTH);
@@ -246,6 +274,7 @@ namespace pksm
                 trade(*pkm);
             }
 
+            markDirty(boxOffset(box, slot), PK6::BOX_LENGTH);
             std::ranges::copy(
                 pkm->rawData().subspan(0, PK6::BOX_LENGTH), &data[boxOffset(box, slot)]);
         }
@@ -340,18 +369,8 @@ namespace pksm
 
     void Sav6::cryptBoxData(bool crypted)
     {
-        for (u8 box = 0; box < maxBoxes(); box++)
-        {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                std::unique_ptr<PKX> pk6 = PKX::getPKM<Generation::SIX>(
-                    &data[boxOffset(box, slot)], PK6::BOX_LENGTH, true);
-                if (!crypted)
-                {
-                    pk6->encrypt();
-                }
-            }
-        }
+        const u32 boxStride = boxOffset(1, 0) - boxOffset(0, 0);
+        cryptBoxSlots<PK6>(&data[boxOffset(0, 0)], boxStride, maxBoxes() * 30, false, crypted);
     }
 
     int Sav6::dexFormIndex(int species, int formct) const
@@ -564,14 +583,17 @@ namespace pksm
         // Owned quality flag
         if (pk.version() < GameVersion::X && bit < 649 && game != Game::ORAS)
         { // Species: 1-649 for X/Y, and not for ORAS; Set the Foreign Owned Flag
+            markDirty(ofs + 0x644, 1);
             data[ofs + 0x644] |= mask;
         }
         else if (pk.version() >= GameVersion::X || game == Game::ORAS)
         { // Set Native Owned Flag (should always happen)
+            markDirty(ofs + (brSize * 0), 1);
             data[ofs + (brSize * 0)] |= mask;
         }
 
         // Set the [Species/Gender/Shiny] Seen Flag
+        markDirty(ofs + shiftoff, 1);
         data[ofs + shiftoff] |= mask;
 
         // Set the Display flag if none are set
@@ -583,6 +605,7 @@ namespace pksm
         if (!displayed)
         { // offset is already biased by brSize, reuse shiftoff but for the display
           // flags.
+            markDirty(ofs + brSize * 4 + shiftoff, 1);
             data[ofs + brSize * 4 + shiftoff] |= mask;
         }
 
@@ -591,12 +614,14 @@ namespace pksm
         {
             lang = 1;
         }
+        markDirty(PokeDexLanguageFlags + (bit * 7 + lang) / 8, 1);
         data[PokeDexLanguageFlags + (bit * 7 + lang) / 8] |= (u8)(1 << ((bit * 7 + lang) % 8));
 
         // Set DexNav count (only if not encountered previously)
         if (game == Game::ORAS &&
             LittleEndian::convertTo<u16>(&data[EncounterCount + (u16(pk.species()) - 1) * 2]) == 0)
         {
+            markDirty(EncounterCount + (u16(pk.species()) - 1) * 2, sizeof(u16));
             LittleEndian::convertFrom<u16>(&data[EncounterCount + (u16(pk.species()) - 1) * 2], 1);
         }
 
@@ -613,6 +638,7 @@ namespace pksm
         bit         = f + pk.alternativeForm();
 
         // Set Form Seen Flag
+        markDirty(formDex + formLen * shiny + bit / 8, 1);
         data[formDex + formLen * shiny + bit / 8] |= (u8)(1 << (bit % 8));
 
         // Set Displayed Flag if necessary, check all flags
@@ -628,7 +654,8 @@ namespace pksm
                 return; // already set
             }
         }
-        bit                                             = f + pk.alternativeForm();
+        bit = f + pk.alternativeForm();
+        markDirty(formDex + formLen * (2 + shiny) + bit / 8, 1);
         data[formDex + formLen * (2 + shiny) + bit / 8] |= (u8)(1 << (bit % 8));
     }
 
@@ -672,13 +699,17 @@ namespace pksm
     {
         if (wc.generation() == Generation::SIX)
         {
+            markDirty(WondercardFlags + wc.ID() / 8, 1);
             data[WondercardFlags + wc.ID() / 8] |= 0x1 << (wc.ID() % 8);
+            markDirty(WondercardData + WC6::length * pos, WC6::length);
             std::copy(wc.rawData(), wc.rawData() + WC6::length,
                 &data[WondercardData + WC6::length * pos]);
             if (game == Game::ORAS && wc.ID() == 2048 && wc.object() == 726)
             {
                 static constexpr u32 EON_MAGIC = 0x225D73C2;
+                markDirty(0x319B8, sizeof(u32));
                 LittleEndian::convertFrom<u32>(&data[0x319B8], EON_MAGIC);
+                markDirty(0x319DE, sizeof(u32));
                 LittleEndian::convertFrom<u32>(&data[0x319DE], EON_MAGIC);
             }
             pos = (pos + 1) % 24;
@@ -693,6 +724,7 @@ namespace pksm
 
     void Sav6::boxName(u8 box, const std::string_view& name)
     {
+        markDirty(PCLayout + 0x22 * box, 17 * 2);
         StringUtils::setString(
             data.get(), StringUtils::transString67(name), PCLayout + 0x22 * box, 17);
     }
@@ -704,6 +736,7 @@ namespace pksm
 
     void Sav6::boxWallpaper(u8 box, u8 v)
     {
+        markDirty(0x4400 + 1054 + box, 1);
         data[0x4400 + 1054 + box] = v;
     }
 
@@ -714,6 +747,7 @@ namespace pksm
 
     void Sav6::partyCount(u8 v)
     {
+        markDirty(Party + 6 * PK6::PARTY_LENGTH, 1);
         data[Party + 6 * PK6::PARTY_LENGTH] = v;
     }
 
@@ -759,18 +793,23 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::NormalItem:
+                markDirty(PouchHeldItem + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
                 break;
             case Pouch::KeyItem:
+                markDirty(PouchKeyItem + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
                 break;
             case Pouch::TM:
+                markDirty(PouchTMHM + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
                 break;
             case Pouch::Medicine:
+                markDirty(PouchMedicine + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
                 break;
             case Pouch::Berry:
+                markDirty(PouchBerry + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
                 break;
             default:
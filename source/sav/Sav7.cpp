@@ -40,6 +40,7 @@ namespace pksm
 
     void Sav7::TID(u16 v)
     {
+        markDirty(TrainerCard, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[TrainerCard], v);
     }
 
@@ -50,6 +51,7 @@ namespace pksm
 
     void Sav7::SID(u16 v)
     {
+        markDirty(TrainerCard + 2, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[TrainerCard + 2], v);
     }
 
@@ -60,6 +62,7 @@ namespace pksm
 
     void Sav7::version(GameVersion v)
     {
+        markDirty(TrainerCard + 4, 1);
         data[TrainerCard + 4] = u8(v);
     }
 
@@ -70,6 +73,7 @@ namespace pksm
 
     void Sav7::gender(Gender v)
     {
+        markDirty(TrainerCard + 5, 1);
         data[TrainerCard + 5] = u8(v);
     }
 
@@ -80,6 +84,7 @@ namespace pksm
 
     void Sav7::subRegion(u8 v)
     {
+        markDirty(TrainerCard + 0x2E, 1);
         data[TrainerCard + 0x2E] = v;
     }
 
@@ -90,6 +95,7 @@ namespace pksm
 
     void Sav7::country(u8 v)
     {
+        markDirty(TrainerCard + 0x2F, 1);
         data[TrainerCard + 0x2F] = v;
     }
 
@@ -100,6 +106,7 @@ namespace pksm
 
     void Sav7::consoleRegion(u8 v)
     {
+        markDirty(TrainerCard + 0x34, 1);
         data[TrainerCard + 0x34] = v;
     }
 
@@ -110,6 +117,7 @@ namespace pksm
 
     void Sav7::language(Language v)
     {
+        markDirty(TrainerCard + 0x35, 1);
         data[TrainerCard + 0x35] = u8(v);
     }
 
@@ -121,6 +129,7 @@ namespace pksm
 
     void Sav7::otName(const std::string_view& v)
     {
+        markDirty(TrainerCard + 0x38, 13 * 2);
         return StringUtils::setString(
             data.get(), StringUtils::transString67(v), TrainerCard + 0x38, 13);
     }
@@ -132,6 +141,7 @@ namespace pksm
 
     void Sav7::money(u32 v)
     {
+        markDirty(Misc + 0x4, sizeof(u32));
         LittleEndian::convertFrom<u32>(&data[Misc + 0x4], v > 9999999 ? 9999999 : v);
     }
 
@@ -142,6 +152,7 @@ namespace pksm
 
     void Sav7::BP(u32 v)
     {
+        markDirty(Misc + 0x11C, sizeof(u32));
         LittleEndian::convertFrom<u32>(&data[Misc + 0x11C], v > 9999 ? 9999 : v);
     }
 
@@ -163,6 +174,7 @@ namespace pksm
 
     void Sav7::playedHours(u16 v)
     {
+        markDirty(PlayTime, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[PlayTime], v);
     }
 
@@ -173,6 +185,7 @@ namespace pksm
 
     void Sav7::playedMinutes(u8 v)
     {
+        markDirty(PlayTime + 2, 1);
         data[PlayTime + 2] = v;
     }
 
@@ -183,6 +196,7 @@ namespace pksm
 
     void Sav7::playedSeconds(u8 v)
     {
+        markDirty(PlayTime + 3, 1);
         data[PlayTime + 3] = v;
     }
 
@@ -193,6 +207,7 @@ namespace pksm
 
     void Sav7::currentBox(u8 v)
     {
+        markDirty(LastViewedBox, 1);
         data[LastViewedBox] = v;
     }
 
@@ -203,6 +218,7 @@ namespace pksm
 
     void Sav7::unlockedBoxes(u8 v)
     {
+        markDirty(LastViewedBox - 2, 1);
         data[LastViewedBox - 2] = v;
     }
 
@@ -227,10 +243,22 @@ namespace pksm
         {
             auto pk7 = pk.partyClone();
             pk7->encrypt();
+            markDirty(partyOffset(slot), PK7::PARTY_LENGTH);
             std::ranges::copy(pk7->rawData(), &data[partyOffset(slot)]);
         }
     }
 
+    PKView<PK7> Sav7::pkmView(u8 box, u8 slot)
+    {
+        markDirty(boxOffset(box, slot), PK7::BOX_LENGTH);
+        return PKView<PK7>(&data[boxOffset(box, slot)]);
+    }
+
+    ConstPKView<PK7> Sav7::pkmConstView(u8 box, u8 slot) const
+    {
+        return ConstPKView<PK7>(&data[boxOffset(box, slot)]);
+    }
+
     std::unique_ptr<PKX> Sav7::pkm(u8 box, u8 slot) const
     {
         return PKX::getPKM<Generation::SEVEN>(&data[boxOffset(box, slot)], PK7::BOX_LENGTH);
@@ -246,6 +274,7 @@ namespace pksm
                 trade(*pkm);
             }
 
+            markDirty(boxOffset(box, slot), PK7::BOX_LENGTH);
             std::ranges::copy(
                 pkm->rawData().subspan(0, PK7::BOX_LENGTH), &data[boxOffset(box, slot)]);
         }
@@ -286,18 +315,8 @@ namespace pksm
 
     void Sav7::cryptBoxData(bool crypted)
     {
-        for (u8 box = 0; box < maxBoxes(); box++)
-        {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                std::unique_ptr<PKX> pk7 = PKX::getPKM<Generation::SEVEN>(
-                    &data[boxOffset(box, slot)], PK7::BOX_LENGTH, true);
-                if (!crypted)
-                {
-                    pk7->encrypt();
-                }
-            }
-        }
+        const u32 boxStride = boxOffset(1, 0) - boxOffset(0, 0);
+        cryptBoxSlots<PK7>(&data[boxOffset(0, 0)], boxStride, maxBoxes() * 30, false, crypted);
     }
 
     void Sav7::setDexFlags(int index, int gender, int shiny, int baseSpecies)
@@ -310,7 +329,8 @@ namespace pksm
         int bd1          = baseSpecies >> 3;
         int bm1          = baseSpecies & 7;
 
-        int brSeen              = shift * brSize;
+        int brSeen = shift * brSize;
+        markDirty(ofs + brSeen + bd, 1);
         data[ofs + brSeen + bd] |= 1 << bm;
 
         bool displayed = false;
@@ -333,6 +353,7 @@ namespace pksm
             return;
         }
 
+        markDirty(ofs + (4 + shift) * brSize + bd, 1);
         data[ofs + (4 + shift) * brSize + bd] |= (1 << bm);
     }
 
@@ -448,17 +469,21 @@ namespace pksm
         {
             if ((data[PokeDex + 0x84] & (1 << (shift + 4))) != 0)
             { // Already 2
+                markDirty(PokeDex + 0x8E8 + shift * 4, sizeof(u32));
                 LittleEndian::convertFrom<u32>(
                     &data[PokeDex + 0x8E8 + shift * 4], pk.encryptionConstant());
+                markDirty(PokeDex + 0x84, 1);
                 data[PokeDex + 0x84] |= (u8)(1 << shift);
             }
             else if ((data[PokeDex + 0x84] & (1 << shift)) == 0)
-            {                                             // Not yet 1
+            { // Not yet 1
+                markDirty(PokeDex + 0x84, 1);
                 data[PokeDex + 0x84] |= (u8)(1 << shift); // 1
             }
         }
 
-        int off        = PokeDex + 0x08 + 0x80;
+        int off = PokeDex + 0x08 + 0x80;
+        markDirty(off + bd, 1);
         data[off + bd] |= 1 << bm;
 
         int formstart = pk.alternativeForm();
@@ -506,6 +531,7 @@ namespace pksm
             int lbit = bit * langCount + lang;
             if (lbit >> 3 < 920)
             {
+                markDirty(PokeDexLanguageFlags + (lbit >> 3), 1);
                 data[PokeDexLanguageFlags + (lbit >> 3)] |= (1 << (lbit & 7));
             }
         }
@@ -560,7 +586,9 @@ namespace pksm
     {
         if (wc.generation() == Generation::SEVEN)
         {
+            markDirty(WondercardFlags + wc.ID() / 8, 1);
             data[WondercardFlags + wc.ID() / 8] |= 0x1 << (wc.ID() % 8);
+            markDirty(WondercardData + WC7::length * pos, WC7::length);
             std::copy(wc.rawData(), wc.rawData() + WC7::length,
                 &data[WondercardData + WC7::length * pos]);
             pos = (pos + 1) % maxWondercards();
@@ -575,6 +603,7 @@ namespace pksm
 
     void Sav7::boxName(u8 box, const std::string_view& name)
     {
+        markDirty(PCLayout + 0x22 * box, 17 * 2);
         StringUtils::setString(
             data.get(), StringUtils::transString67(name), PCLayout + 0x22 * box, 17);
     }
@@ -586,6 +615,7 @@ namespace pksm
 
     void Sav7::boxWallpaper(u8 box, u8 v)
     {
+        markDirty(PCLayout + 1472 + box, 1);
         data[PCLayout + 1472 + box] = v;
     }
 
@@ -596,6 +626,7 @@ namespace pksm
 
     void Sav7::partyCount(u8 v)
     {
+        markDirty(Party + 6 * PK7::PARTY_LENGTH, 1);
         data[Party + 6 * PK7::PARTY_LENGTH] = v;
     }
 
@@ -641,24 +672,31 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::NormalItem:
+                markDirty(PouchHeldItem + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
                 break;
             case Pouch::KeyItem:
+                markDirty(PouchKeyItem + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
                 break;
             case Pouch::TM:
+                markDirty(PouchTMHM + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
                 break;
             case Pouch::Medicine:
+                markDirty(PouchMedicine + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
                 break;
             case Pouch::Berry:
+                markDirty(PouchBerry + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
                 break;
             case Pouch::ZCrystals:
+                markDirty(PouchZCrystals + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[PouchZCrystals + slot * 4]);
                 break;
             case Pouch::RotomPower:
+                markDirty(BattleItems + slot * 4, write.size());
                 std::copy(write.begin(), write.end(), &data[BattleItems + slot * 4]);
                 break;
             default:
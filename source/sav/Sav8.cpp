@@ -26,27 +26,31 @@
 
 #include "sav/Sav8.hpp"
 #include "pkx/PK8.hpp"
-#include <algorithm>
+#include "utils/parallel.hpp"
 
 namespace pksm
 {
-    Sav8::Sav8(const std::shared_ptr<u8[]>& dt, size_t length) : Sav(dt, length)
+    Sav8::Sav8(const std::shared_ptr<u8[]>& dt, size_t length, bool lazyBlocks, unsigned threads)
+        : Sav(dt, length), threads(threads)
     {
-        pksm::crypto::swsh::applyXor(dt, length);
-        blocks = pksm::crypto::swsh::getBlockList(dt, length);
+        pksm::crypto::swsh::applyXor(std::span{dt.get(), length - 32});
+        // The walk itself is serial, as each block's length is only known after decrypting its
+        // header, but the block contents can then be decrypted independently
+        blocks = pksm::crypto::swsh::getBlockList(dt, length, true);
+        if (!lazyBlocks)
+        {
+            parallelFor(blocks.size(), threads, [this](size_t i) { blocks[i].decrypt(); });
+        }
     }
 
-    std::shared_ptr<pksm::crypto::swsh::SCBlock> Sav8::getBlock(u32 key) const
+    u8* Sav8::pinBlock(u32 key)
     {
-        // binary search
-        auto found = std::lower_bound(blocks.begin(), blocks.end(), key,
-            [](const std::shared_ptr<pksm::crypto::swsh::SCBlock>& block, u32 key)
-            { return block->key() < key; });
-        if ((*found)->key() != key)
+        if (auto block = getBlock(key))
         {
-            return nullptr;
+            pinnedBlocks.emplace_back(block);
+            return block.decryptedData();
         }
-        return *found;
+        return nullptr;
     }
 
     std::unique_ptr<PKX> Sav8::emptyPkm() const
@@ -91,12 +95,9 @@ namespace pksm
     {
         if (!encrypted)
         {
-            for (auto& block : blocks)
-            {
-                block->encrypt();
-            }
+            parallelFor(blocks.size(), threads, [this](size_t i) { blocks[i].encrypt(); });
 
-            pksm::crypto::swsh::applyXor(data, length);
+            pksm::crypto::swsh::applyXor(std::span{data.get(), length - 32});
             pksm::crypto::swsh::sign(data, length);
         }
         encrypted = true;
@@ -106,11 +107,15 @@ namespace pksm
     {
         if (encrypted)
         {
-            pksm::crypto::swsh::applyXor(data, length);
+            pksm::crypto::swsh::applyXor(std::span{data.get(), length - 32});
         }
         encrypted = false;
 
-        // I could decrypt every block here, but why not just let them be done on the fly via the
-        // functions that need them?
+        // Pinned blocks have their data pointers cached, so they need to be ready right away. The
+        // rest are decrypted on the fly by the functions that need them
+        for (auto& block : pinnedBlocks)
+        {
+            block.decrypt();
+        }
     }
 }
@@ -58,7 +58,13 @@ namespace pksm
 
         for (u8 i = 0; i < blockCount; i++)
         {
+            if (!isDirty(blockOfs[i], lengths[i]))
+            {
+                continue;
+            }
             u16 cs = pksm::crypto::ccitt16({&data[blockOfs[i]], lengths[i]});
+            // The mirrors live in a block that is itself checksummed later on
+            markDirty(chkMirror[i], sizeof(u16));
             LittleEndian::convertFrom<u16>(&data[chkMirror[i]], cs);
             LittleEndian::convertFrom<u16>(&data[chkofs[i]], cs);
         }
@@ -76,8 +82,12 @@ namespace pksm
             // header_size - 4);
             // pksm::crypto::pkm::crypt<size_to_checksum - 4>(data.get() + offset
             // + header_size, seed);
-            u16 crc = pksm::crypto::ccitt16({data.get() + offset + header_size, size_to_checksum});
-            LittleEndian::convertFrom<u16>(data.get() + offset + crc_offset_from_start, crc);
+            if (isDirty(offset + header_size, size_to_checksum))
+            {
+                u16 crc =
+                    pksm::crypto::ccitt16({data.get() + offset + header_size, size_to_checksum});
+                LittleEndian::convertFrom<u16>(data.get() + offset + crc_offset_from_start, crc);
+            }
         }
         // Block 1 mirror
         {
@@ -89,8 +99,12 @@ namespace pksm
             // header_size - 4);
             // pksm::crypto::pkm::crypt<size_to_checksum - 4>(data.get() + offset
             // + header_size, seed);
-            u16 crc = pksm::crypto::ccitt16({data.get() + offset + header_size, size_to_checksum});
-            LittleEndian::convertFrom<u16>(data.get() + offset + crc_offset_from_start, crc);
+            if (isDirty(offset + header_size, size_to_checksum))
+            {
+                u16 crc =
+                    pksm::crypto::ccitt16({data.get() + offset + header_size, size_to_checksum});
+                LittleEndian::convertFrom<u16>(data.get() + offset + crc_offset_from_start, crc);
+            }
         }
         // Block 2
         {
@@ -98,8 +112,12 @@ namespace pksm
             static constexpr u32 size_to_checksum      = 0x214;
             static constexpr u32 header_size           = 0xC;
             static constexpr u32 crc_offset_from_start = 0x8;
-            u16 crc = pksm::crypto::ccitt16({data.get() + offset + header_size, size_to_checksum});
-            LittleEndian::convertFrom<u16>(data.get() + offset + crc_offset_from_start, crc);
+            if (isDirty(offset + header_size, size_to_checksum))
+            {
+                u16 crc =
+                    pksm::crypto::ccitt16({data.get() + offset + header_size, size_to_checksum});
+                LittleEndian::convertFrom<u16>(data.get() + offset + crc_offset_from_start, crc);
+            }
         }
     }
 
@@ -58,7 +58,13 @@ namespace pksm
 
         for (u8 i = 0; i < blockCount; i++)
         {
+            if (!isDirty(blockOfs[i], lengths[i]))
+            {
+                continue;
+            }
             u16 cs = pksm::crypto::ccitt16({&data[blockOfs[i]], lengths[i]});
+            // The mirrors live in a block that is itself checksummed later on
+            markDirty(chkMirror[i], sizeof(u16));
             LittleEndian::convertFrom<u16>(&data[chkMirror[i]], cs);
             LittleEndian::convertFrom<u16>(&data[chkofs[i]], cs);
         }
@@ -67,6 +67,7 @@ namespace pksm
 
     void SavLGPE::partyBoxSlot(u8 slot, u16 v)
     {
+        markDirty(0x5A00 + slot * 2, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[0x5A00 + slot * 2], v);
     }
 
@@ -87,6 +88,7 @@ namespace pksm
 
     void SavLGPE::boxedPkm(u16 v)
     {
+        markDirty(0x5A00 + 14, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[0x5A00 + 14], v);
     }
 
@@ -97,6 +99,7 @@ namespace pksm
 
     void SavLGPE::followPkm(u16 v)
     {
+        markDirty(0x5A00 + 12, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[0x5A00 + 12], v);
     }
 
@@ -145,6 +148,8 @@ namespace pksm
                 {
                     u32 emptyOffset = boxOffset(emptyIndex / 30, emptyIndex % 30);
                     // Swap the two slots
+                    markDirty(emptyOffset, PB7::PARTY_LENGTH);
+                    markDirty(offset, PB7::PARTY_LENGTH);
                     std::copy(
                         &data[emptyOffset], &data[emptyOffset + PB7::PARTY_LENGTH], emptyData);
                     std::copy(&data[offset], &data[offset + PB7::PARTY_LENGTH], &data[emptyOffset]);
@@ -173,6 +178,10 @@ namespace pksm
 
         for (u8 i = 0; i < blockCount; i++)
         {
+            if (!isDirty(chkofs[i], chklen[i]))
+            {
+                continue;
+            }
             LittleEndian::convertFrom<u16>(
                 &data[csoff + i * 8], pksm::crypto::crc16_noinvert({&data[chkofs[i]], chklen[i]}));
         }
@@ -185,6 +194,7 @@ namespace pksm
 
     void SavLGPE::TID(u16 v)
     {
+        markDirty(0x1000, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[0x1000], v);
     }
 
@@ -195,6 +205,7 @@ namespace pksm
 
     void SavLGPE::SID(u16 v)
     {
+        markDirty(0x1002, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[0x1002], v);
     }
 
@@ -205,6 +216,7 @@ namespace pksm
 
     void SavLGPE::version(GameVersion v)
     {
+        markDirty(0x1004, 1);
         data[0x1004] = u8(v);
     }
 
@@ -215,6 +227,7 @@ namespace pksm
 
     void SavLGPE::gender(Gender v)
     {
+        markDirty(0x1005, 1);
         data[0x1005] = u8(v);
     }
 
@@ -225,6 +238,7 @@ namespace pksm
 
     void SavLGPE::language(Language v)
     {
+        markDirty(0x1035, 1);
         data[0x1035] = u8(v);
     }
 
@@ -235,6 +249,7 @@ namespace pksm
 
     void SavLGPE::otName(const std::string_view& v)
     {
+        markDirty(0x1000 + 0x38, 13 * 2);
         StringUtils::setString(data.get(), v, 0x1000 + 0x38, 13);
     }
 
@@ -245,6 +260,7 @@ namespace pksm
 
     void SavLGPE::money(u32 v)
     {
+        markDirty(0x4C04, sizeof(u32));
         LittleEndian::convertFrom<u32>(&data[0x4C04], v);
     }
 
@@ -274,6 +290,7 @@ namespace pksm
 
     void SavLGPE::playedHours(u16 v)
     {
+        markDirty(0x45400, sizeof(u16));
         LittleEndian::convertFrom<u16>(&data[0x45400], v);
     }
 
@@ -284,6 +301,7 @@ namespace pksm
 
     void SavLGPE::playedMinutes(u8 v)
     {
+        markDirty(0x45402, 1);
         data[0x45402] = v;
     }
 
@@ -294,6 +312,7 @@ namespace pksm
 
     void SavLGPE::playedSeconds(u8 v)
     {
+        markDirty(0x45403, 1);
         data[0x45403] = v;
     }
 
@@ -325,6 +344,7 @@ namespace pksm
                 trade(*pb7);
             }
 
+            markDirty(boxOffset(box, slot), PB7::PARTY_LENGTH);
             std::ranges::copy(
                 pb7->rawData().subspan(0, PB7::PARTY_LENGTH), &data[boxOffset(box, slot)]);
         }
@@ -340,6 +360,7 @@ namespace pksm
             {
                 if (off != 0)
                 {
+                    markDirty(off, PB7::PARTY_LENGTH);
                     std::fill_n(&data[off], PB7::PARTY_LENGTH, 0);
                 }
                 partyBoxSlot(slot, 1001);
@@ -363,11 +384,23 @@ namespace pksm
             }
 
             auto pb7 = pk.partyClone();
+            markDirty(off, PB7::PARTY_LENGTH);
             std::ranges::copy(pb7->rawData().subspan(0, PB7::PARTY_LENGTH), &data[off]);
             partyBoxSlot(slot, newSlot);
         }
     }
 
+    PKView<PB7> SavLGPE::pkmView(u8 box, u8 slot)
+    {
+        markDirty(boxOffset(box, slot), PB7::PARTY_LENGTH);
+        return PKView<PB7>(&data[boxOffset(box, slot)], true);
+    }
+
+    ConstPKView<PB7> SavLGPE::pkmConstView(u8 box, u8 slot) const
+    {
+        return ConstPKView<PB7>(&data[boxOffset(box, slot)], true);
+    }
+
     void SavLGPE::trade(PKX& pk, const Date& date) const
     {
         if (pk.generation() == Generation::LGPE)
@@ -461,7 +494,8 @@ namespace pksm
         int bd1          = baseSpecies >> 3;
         int bm1          = baseSpecies & 7;
 
-        int brSeen              = shift * brSize;
+        int brSeen = shift * brSize;
+        markDirty(off + brSeen + bd, 1);
         data[off + brSeen + bd] |= (u8)(1 << bm);
 
         bool displayed = false;
@@ -484,6 +518,7 @@ namespace pksm
             return;
         }
 
+        markDirty(off + (4 + shift) * brSize + bd, 1);
         data[off + (4 + shift) * brSize + bd] |= (1 << bm);
     }
 
@@ -539,17 +574,21 @@ namespace pksm
         {
             if ((data[PokeDex + 0x84] & (1 << (shift + 4))) != 0)
             { // Already 2
+                markDirty(PokeDex + 0x8E8 + shift * 4, sizeof(u32));
                 LittleEndian::convertFrom<u32>(
                     &data[PokeDex + 0x8E8 + shift * 4], pk.encryptionConstant());
+                markDirty(PokeDex + 0x84, 1);
                 data[PokeDex + 0x84] |= (u8)(1 << shift);
             }
             else if ((data[PokeDex + 0x84] & (1 << shift)) == 0)
-            {                                             // Not yet 1
+            { // Not yet 1
+                markDirty(PokeDex + 0x84, 1);
                 data[PokeDex + 0x84] |= (u8)(1 << shift); // 1
             }
         }
 
-        int off        = PokeDex + 0x08 + 0x80;
+        int off = PokeDex + 0x08 + 0x80;
+        markDirty(off + bd, 1);
         data[off + bd] |= (1 << bm);
 
         int formstart = pk.alternativeForm();
@@ -596,6 +635,7 @@ namespace pksm
             int lbit = bit * langCount + lang;
             if (lbit >> 3 < 920)
             {
+                markDirty(PokeDexLanguageFlags + (lbit >> 3), 1);
                 data[PokeDexLanguageFlags + (lbit >> 3)] |= (u8)(1 << (lbit & 7));
             }
         }
@@ -644,22 +684,8 @@ namespace pksm
 
     void SavLGPE::cryptBoxData(bool crypted)
     {
-        for (u8 box = 0; box < maxBoxes(); box++)
-        {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                if (box * 30 + slot > 1000)
-                {
-                    return;
-                }
-                std::unique_ptr<PKX> pb7 = PKX::getPKM<Generation::LGPE>(
-                    &data[boxOffset(box, slot)], PB7::PARTY_LENGTH, true);
-                if (!crypted)
-                {
-                    pb7->encrypt();
-                }
-            }
-        }
+        const u32 boxStride = boxOffset(1, 0) - boxOffset(0, 0);
+        cryptBoxSlots<PB7>(&data[boxOffset(0, 0)], boxStride, maxSlot(), true, crypted);
     }
 
     void SavLGPE::mysteryGift(const WCX& wc, int&)
@@ -897,36 +923,42 @@ namespace pksm
             case Pouch::Medicine:
                 if (slot < 60)
                 {
+                    markDirty(slot * 4, write.size());
                     std::copy(write.begin(), write.end(), &data[slot * 4]);
                 }
                 break;
             case Pouch::TM:
                 if (slot < 108)
                 {
+                    markDirty(0xF0 + slot * 4, write.size());
                     std::copy(write.begin(), write.end(), &data[0xF0 + slot * 4]);
                 }
                 break;
             case Pouch::Candy:
                 if (slot < 200)
                 {
+                    markDirty(0x2A0 + slot * 4, write.size());
                     std::copy(write.begin(), write.end(), &data[0x2A0 + slot * 4]);
                 }
                 break;
             case Pouch::ZCrystals:
                 if (slot < 150)
                 {
+                    markDirty(0x5C0 + slot * 4, write.size());
                     std::copy(write.begin(), write.end(), &data[0x5C0 + slot * 4]);
                 }
                 break;
             case Pouch::CatchingItem:
                 if (slot < 50)
                 {
+                    markDirty(0x818 + slot * 4, write.size());
                     std::copy(write.begin(), write.end(), &data[0x818 + slot * 4]);
                 }
                 break;
             case Pouch::Battle:
                 if (slot < 150)
                 {
+                    markDirty(0x8E0 + slot * 4, write.size());
                     std::copy(write.begin(), write.end(), &data[0x8E0 + slot * 4]);
                 }
                 break;
@@ -934,6 +966,7 @@ namespace pksm
             case Pouch::NormalItem:
                 if (slot < 150)
                 {
+                    markDirty(0xB38 + slot * 4, write.size());
                     std::copy(write.begin(), write.end(), &data[0xB38 + slot * 4]);
                 }
                 break;
@@ -60,8 +60,14 @@ namespace pksm
         static constexpr u8 blockCount = 37;
         static constexpr u32 csoff     = 0x6BC1A;
 
+        bool resigned = false;
         for (u8 i = 0; i < blockCount; i++)
         {
+            if (!isDirty(chkofs[i], chklen[i]))
+            {
+                continue;
+            }
+            resigned = true;
             // Clear memecrypto data
             if (LittleEndian::convertTo<u16>(&data[csoff + i * 8 - 2]) == 36)
             {
@@ -71,6 +77,12 @@ namespace pksm
                 &data[csoff + i * 8], pksm::crypto::crc16({&data[chkofs[i]], chklen[i]}));
         }
 
+        // The signature only covers the checksum table
+        if (!resigned)
+        {
+            return;
+        }
+
         static constexpr u32 checksumTableOffset = 0x6BC00;
         static constexpr u32 checksumTableLength = 0x140;
         static constexpr u32 memecryptoOffset    = 0x6BB00;
@@ -182,7 +182,9 @@ constexpr void LittleEndian::convertFrom<DexEntry>(u8* data, const DexEntry& ent
 
 namespace pksm
 {
-    SavSWSH::SavSWSH(const std::shared_ptr<u8[]>& dt, size_t length) : Sav8(dt, length)
+    SavSWSH::SavSWSH(
+        const std::shared_ptr<u8[]>& dt, size_t length, bool lazyBlocks, unsigned threads)
+        : Sav8(dt, length, lazyBlocks, threads)
     {
         game = Game::SWSH;
 
@@ -198,137 +200,151 @@ namespace pksm
         TrainerCard    = 0x874da6fa;
         PlayTime       = 0x8cbbfd90;
         Status         = 0xf25c070e;
+
+        boxBlock         = pinBlock(Box);
+        partyBlock       = pinBlock(Party);
+        dexBlock         = pinBlock(PokeDex);
+        armorDexBlock    = pinBlock(ArmorDex);
+        crownDexBlock    = pinBlock(CrownDex);
+        itemBlock        = pinBlock(Items);
+        boxLayoutBlock   = pinBlock(BoxLayout);
+        miscBlock        = pinBlock(Misc);
+        trainerCardBlock = pinBlock(TrainerCard);
+        playTimeBlock    = pinBlock(PlayTime);
+        statusBlock      = pinBlock(Status);
+        currentBoxBlock  = pinBlock(0x017C3CBB);
+        wallpaperBlock   = pinBlock(0x2EB1B190);
     }
 
     u16 SavSWSH::TID(void) const
     {
-        return LittleEndian::convertTo<u16>(getBlock(Status)->decryptedData() + 0xA0);
+        return LittleEndian::convertTo<u16>(statusBlock + 0xA0);
     }
 
     void SavSWSH::TID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(getBlock(Status)->decryptedData() + 0xA0, v);
-        LittleEndian::convertFrom<u32>(getBlock(TrainerCard)->decryptedData() + 0x1C, displayTID());
+        LittleEndian::convertFrom<u16>(statusBlock + 0xA0, v);
+        LittleEndian::convertFrom<u32>(trainerCardBlock + 0x1C, displayTID());
     }
 
     u16 SavSWSH::SID(void) const
     {
-        return LittleEndian::convertTo<u16>(getBlock(Status)->decryptedData() + 0xA2);
+        return LittleEndian::convertTo<u16>(statusBlock + 0xA2);
     }
 
     void SavSWSH::SID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(getBlock(Status)->decryptedData() + 0xA2, v);
-        LittleEndian::convertFrom<u32>(getBlock(TrainerCard)->decryptedData() + 0x1C, displayTID());
+        LittleEndian::convertFrom<u16>(statusBlock + 0xA2, v);
+        LittleEndian::convertFrom<u32>(trainerCardBlock + 0x1C, displayTID());
     }
 
     GameVersion SavSWSH::version(void) const
     {
-        return GameVersion(getBlock(Status)->decryptedData()[0xA4]);
+        return GameVersion(statusBlock[0xA4]);
     }
 
     void SavSWSH::version(GameVersion v)
     {
-        getBlock(Status)->decryptedData()[0xA4] = u8(v);
+        statusBlock[0xA4] = u8(v);
     }
 
     Gender SavSWSH::gender(void) const
     {
-        return Gender{getBlock(Status)->decryptedData()[0xA5]};
+        return Gender{statusBlock[0xA5]};
     }
 
     void SavSWSH::gender(Gender v)
     {
-        getBlock(Status)->decryptedData()[0xA5] = u8(v);
+        statusBlock[0xA5] = u8(v);
     }
 
     Language SavSWSH::language(void) const
     {
-        return Language(getBlock(Status)->decryptedData()[0xA7]);
+        return Language(statusBlock[0xA7]);
     }
 
     void SavSWSH::language(Language v)
     {
-        getBlock(Status)->decryptedData()[0xA7] = u8(v);
+        statusBlock[0xA7] = u8(v);
     }
 
     std::string SavSWSH::otName(void) const
     {
-        return StringUtils::getString(getBlock(Status)->decryptedData(), 0xB0, 13);
+        return StringUtils::getString(statusBlock, 0xB0, 13);
     }
 
     void SavSWSH::otName(const std::string_view& v)
     {
-        StringUtils::setString(getBlock(Status)->decryptedData(), v, 0xB0, 13);
-        StringUtils::setString(getBlock(TrainerCard)->decryptedData(), v, 0, 13);
+        StringUtils::setString(statusBlock, v, 0xB0, 13);
+        StringUtils::setString(trainerCardBlock, v, 0, 13);
     }
 
     std::string SavSWSH::jerseyNum(void) const
     {
-        return std::string((char*)getBlock(TrainerCard)->decryptedData() + 0x39, 3);
+        return std::string((char*)trainerCardBlock + 0x39, 3);
     }
 
     void SavSWSH::jerseyNum(const std::string_view& v)
     {
         for (size_t i = 0; i < std::min(v.size(), (size_t)3); i++)
         {
-            getBlock(TrainerCard)->decryptedData()[0x39 + i] = v[i];
+            trainerCardBlock[0x39 + i] = v[i];
         }
     }
 
     u32 SavSWSH::money(void) const
     {
-        return LittleEndian::convertTo<u32>(getBlock(Misc)->decryptedData());
+        return LittleEndian::convertTo<u32>(miscBlock);
     }
 
     void SavSWSH::money(u32 v)
     {
-        LittleEndian::convertFrom<u32>(getBlock(Misc)->decryptedData(), v);
+        LittleEndian::convertFrom<u32>(miscBlock, v);
     }
 
     u32 SavSWSH::BP(void) const
     {
-        return LittleEndian::convertTo<u32>(getBlock(Misc)->decryptedData() + 4);
+        return LittleEndian::convertTo<u32>(miscBlock + 4);
     }
 
     void SavSWSH::BP(u32 v)
     {
-        LittleEndian::convertFrom<u32>(getBlock(Misc)->decryptedData() + 4, v);
+        LittleEndian::convertFrom<u32>(miscBlock + 4, v);
     }
 
     u8 SavSWSH::badges(void) const
     {
-        return getBlock(Misc)->decryptedData()[0x11C];
+        return miscBlock[0x11C];
     }
 
     u16 SavSWSH::playedHours(void) const
     {
-        return LittleEndian::convertTo<u16>(getBlock(PlayTime)->decryptedData());
+        return LittleEndian::convertTo<u16>(playTimeBlock);
     }
 
     void SavSWSH::playedHours(u16 v)
     {
-        LittleEndian::convertFrom<u16>(getBlock(PlayTime)->decryptedData(), v);
+        LittleEndian::convertFrom<u16>(playTimeBlock, v);
     }
 
     u8 SavSWSH::playedMinutes(void) const
     {
-        return getBlock(PlayTime)->decryptedData()[2];
+        return playTimeBlock[2];
     }
 
     void SavSWSH::playedMinutes(u8 v)
     {
-        getBlock(PlayTime)->decryptedData()[2] = v;
+        playTimeBlock[2] = v;
     }
 
     u8 SavSWSH::playedSeconds(void) const
     {
-        return getBlock(PlayTime)->decryptedData()[3];
+        return playTimeBlock[3];
     }
 
     void SavSWSH::playedSeconds(u8 v)
     {
-        getBlock(PlayTime)->decryptedData()[3] = v;
+        playTimeBlock[3] = v;
     }
 
     void SavSWSH::item(const Item& item, Pouch pouch, u16 slot)
@@ -338,39 +354,32 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::Medicine:
-                std::copy(write.begin(), write.end(), getBlock(Items)->decryptedData() + 4 * slot);
+                std::copy(write.begin(), write.end(), itemBlock + 4 * slot);
                 break;
             case Pouch::Ball:
                 std::copy(
-                    write.begin(), write.end(), getBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
+                    write.begin(), write.end(), itemBlock + 0xF0 + 4 * slot);
                 break;
             case Pouch::Battle:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x168 + 4 * slot);
+                std::copy(write.begin(), write.end(), itemBlock + 0x168 + 4 * slot);
                 break;
             case Pouch::Berry:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
+                std::copy(write.begin(), write.end(), itemBlock + 0x1B8 + 4 * slot);
                 break;
             case Pouch::NormalItem:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
+                std::copy(write.begin(), write.end(), itemBlock + 0x2F8 + 4 * slot);
                 break;
             case Pouch::TM:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
+                std::copy(write.begin(), write.end(), itemBlock + 0xB90 + 4 * slot);
                 break;
             case Pouch::Treasure:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
+                std::copy(write.begin(), write.end(), itemBlock + 0xED8 + 4 * slot);
                 break;
             case Pouch::Ingredient:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
+                std::copy(write.begin(), write.end(), itemBlock + 0x1068 + 4 * slot);
                 break;
             case Pouch::KeyItem:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
+                std::copy(write.begin(), write.end(), itemBlock + 0x11F8 + 4 * slot);
                 break;
             default:
                 break;
@@ -382,25 +391,23 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::Medicine:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 4 * slot);
+                return std::make_unique<Item8>(itemBlock + 4 * slot);
             case Pouch::Ball:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
+                return std::make_unique<Item8>(itemBlock + 0xF0 + 4 * slot);
             case Pouch::Battle:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x168 + 4 * slot);
+                return std::make_unique<Item8>(itemBlock + 0x168 + 4 * slot);
             case Pouch::Berry:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
+                return std::make_unique<Item8>(itemBlock + 0x1B8 + 4 * slot);
             case Pouch::NormalItem:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
+                return std::make_unique<Item8>(itemBlock + 0x2F8 + 4 * slot);
             case Pouch::TM:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
+                return std::make_unique<Item8>(itemBlock + 0xB90 + 4 * slot);
             case Pouch::Treasure:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
+                return std::make_unique<Item8>(itemBlock + 0xED8 + 4 * slot);
             case Pouch::Ingredient:
-                return std::make_unique<Item8>(
-                    getBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
+                return std::make_unique<Item8>(itemBlock + 0x1068 + 4 * slot);
             case Pouch::KeyItem:
-                return std::make_unique<Item8>(
-                    getBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
+                return std::make_unique<Item8>(itemBlock + 0x11F8 + 4 * slot);
             default:
                 return std::make_unique<Item8>();
         }
@@ -516,32 +523,32 @@ namespace pksm
 
     u8 SavSWSH::currentBox() const
     {
-        return LittleEndian::convertTo<u32>(getBlock(0x017C3CBB)->decryptedData());
+        return LittleEndian::convertTo<u32>(currentBoxBlock);
     }
 
     void SavSWSH::currentBox(u8 box)
     {
-        LittleEndian::convertFrom<u32>(getBlock(0x017C3CBB)->decryptedData(), box);
+        LittleEndian::convertFrom<u32>(currentBoxBlock, box);
     }
 
     std::string SavSWSH::boxName(u8 box) const
     {
-        return StringUtils::getString(getBlock(BoxLayout)->decryptedData(), box * 0x22, 17);
+        return StringUtils::getString(boxLayoutBlock, box * 0x22, 17);
     }
 
     void SavSWSH::boxName(u8 box, const std::string_view& name)
     {
-        StringUtils::setString(getBlock(BoxLayout)->decryptedData(), name, box * 0x22, 17);
+        StringUtils::setString(boxLayoutBlock, name, box * 0x22, 17);
     }
 
     u8 SavSWSH::boxWallpaper(u8 box) const
     {
-        return LittleEndian::convertTo<u32>(getBlock(0x017C3CBB)->decryptedData() + box * 4);
+        return LittleEndian::convertTo<u32>(currentBoxBlock + box * 4);
     }
 
     void SavSWSH::boxWallpaper(u8 box, u8 v)
     {
-        LittleEndian::convertFrom<u32>(getBlock(0x2EB1B190)->decryptedData() + box * 4, v);
+        LittleEndian::convertFrom<u32>(wallpaperBlock + box * 4, v);
     }
 
     u32 SavSWSH::boxOffset(u8 box, u8 slot) const
@@ -556,26 +563,24 @@ namespace pksm
 
     u8 SavSWSH::partyCount(void) const
     {
-        return getBlock(Party)->decryptedData()[PK8::PARTY_LENGTH * 6];
+        return partyBlock[PK8::PARTY_LENGTH * 6];
     }
 
     void SavSWSH::partyCount(u8 count)
     {
-        getBlock(Party)->decryptedData()[PK8::PARTY_LENGTH * 6] = count;
+        partyBlock[PK8::PARTY_LENGTH * 6] = count;
     }
 
     std::unique_ptr<PKX> SavSWSH::pkm(u8 slot) const
     {
         u32 offset = partyOffset(slot);
-        return PKX::getPKM<Generation::EIGHT>(
-            getBlock(Party)->decryptedData() + offset, PK8::PARTY_LENGTH);
+        return PKX::getPKM<Generation::EIGHT>(partyBlock + offset, PK8::PARTY_LENGTH);
     }
 
     std::unique_ptr<PKX> SavSWSH::pkm(u8 box, u8 slot) const
     {
         u32 offset = boxOffset(box, slot);
-        return PKX::getPKM<Generation::EIGHT>(
-            getBlock(Box)->decryptedData() + offset, PK8::PARTY_LENGTH);
+        return PKX::getPKM<Generation::EIGHT>(boxBlock + offset, PK8::PARTY_LENGTH);
     }
 
     void SavSWSH::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
@@ -588,8 +593,7 @@ namespace pksm
                 trade(*pk8);
             }
 
-            std::ranges::copy(
-                pk8->rawData(), getBlock(Box)->decryptedData() + boxOffset(box, slot));
+            std::ranges::copy(pk8->rawData(), boxBlock + boxOffset(box, slot));
         }
     }
 
@@ -599,24 +603,24 @@ namespace pksm
         {
             auto pk8 = pk.partyClone();
             pk8->encrypt();
-            std::ranges::copy(pk8->rawData(), getBlock(Party)->decryptedData() + partyOffset(slot));
+            std::ranges::copy(pk8->rawData(), partyBlock + partyOffset(slot));
         }
     }
 
+    PKView<PK8> SavSWSH::pkmView(u8 box, u8 slot)
+    {
+        return PKView<PK8>(boxBlock + boxOffset(box, slot), true);
+    }
+
+    ConstPKView<PK8> SavSWSH::pkmConstView(u8 box, u8 slot) const
+    {
+        return ConstPKView<PK8>(boxBlock + boxOffset(box, slot), true);
+    }
+
     void SavSWSH::cryptBoxData(bool crypted)
     {
-        for (u8 box = 0; box < maxBoxes(); box++)
-        {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                std::unique_ptr<PKX> pk8 = PKX::getPKM<Generation::EIGHT>(
-                    getBlock(Box)->decryptedData() + boxOffset(box, slot), PK8::PARTY_LENGTH, true);
-                if (!crypted)
-                {
-                    pk8->encrypt();
-                }
-            }
-        }
+        const u32 boxStride = boxOffset(1, 0) - boxOffset(0, 0);
+        cryptBoxSlots<PK8>(boxBlock, boxStride, maxBoxes() * 30, true, crypted, threads);
     }
 
     void SavSWSH::mysteryGift(const WCX& wc, int&)
@@ -912,15 +916,15 @@ namespace pksm
         {
             if (u16 index = ((PK8&)pk).pokedexIndex())
             {
-                entryAddr = getBlock(PokeDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
+                entryAddr = dexBlock + sizeof(DexEntry) * (index - 1);
             }
             else if (u16 index = static_cast<const PK8&>(pk).armordexIndex())
             {
-                entryAddr = getBlock(ArmorDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
+                entryAddr = armorDexBlock + sizeof(DexEntry) * (index - 1);
             }
             else if (u16 index = static_cast<const PK8&>(pk).crowndexIndex())
             {
-                entryAddr = getBlock(CrownDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
+                entryAddr = crownDexBlock + sizeof(DexEntry) * (index - 1);
             }
         }
 
@@ -961,7 +965,7 @@ namespace pksm
         for (const auto& i : availableSpecies())
         {
             u16 index       = PersonalSWSH::pokedexIndex(u16(i));
-            u8* entryOffset = getBlock(PokeDex)->decryptedData() + index * sizeof(DexEntry);
+            u8* entryOffset = dexBlock + index * sizeof(DexEntry);
             for (size_t j = 0; j < 0x20; j++) // Entire seen region size
             {
                 if (entryOffset[j])
@@ -980,7 +984,7 @@ namespace pksm
         for (const auto& i : availableSpecies())
         {
             u16 index       = PersonalSWSH::pokedexIndex(u16(i));
-            u8* entryOffset = getBlock(PokeDex)->decryptedData() + index * sizeof(DexEntry);
+            u8* entryOffset = dexBlock + index * sizeof(DexEntry);
             if (entryOffset[0x20] & 3)
             {
                 ret++;
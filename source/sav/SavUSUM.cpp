@@ -61,8 +61,14 @@ namespace pksm
         static constexpr u8 blockCount = 39;
         static constexpr u32 csoff     = 0x6CA1A;
 
+        bool resigned = false;
         for (u8 i = 0; i < blockCount; i++)
         {
+            if (!isDirty(chkofs[i], chklen[i]))
+            {
+                continue;
+            }
+            resigned = true;
             // Clear memecrypto data
             if (LittleEndian::convertTo<u16>(&data[csoff + i * 8 - 2]) == 36)
             {
@@ -72,6 +78,12 @@ namespace pksm
                 &data[csoff + i * 8], pksm::crypto::crc16({&data[chkofs[i]], chklen[i]}));
         }
 
+        // The signature only covers the checksum table
+        if (!resigned)
+        {
+            return;
+        }
+
         const u32 checksumTableOffset = 0x6CA00;
         const u32 checksumTableLength = 0x150;
         const u32 memecryptoOffset    = 0x6C100;
@@ -61,6 +61,10 @@ namespace pksm
 
         for (u8 i = 0; i < blockCount; i++)
         {
+            if (!isDirty(chkofs[i], chklen[i]))
+            {
+                continue;
+            }
             LittleEndian::convertFrom<u16>(
                 &data[csoff + i * 8], pksm::crypto::ccitt16({&data[chkofs[i]], chklen[i]}));
         }
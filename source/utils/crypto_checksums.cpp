@@ -56,6 +56,30 @@ namespace pksm::crypto
             0x4C80, 0x8C41, 0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201,
             0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040};
 
+        // ccitt16_tables[0] is the usual byte-at-a-time table for polynomial 0x1021;
+        // ccitt16_tables[n] is the contribution of a byte followed by n zero bytes
+        constexpr std::array<std::array<u16, 256>, 8> ccitt16_tables = []
+        {
+            std::array<std::array<u16, 256>, 8> ret{};
+            for (u32 i = 0; i < 256; i++)
+            {
+                u16 crc = i << 8;
+                for (u32 j = 0; j < 8; j++)
+                {
+                    crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+                }
+                ret[0][i] = crc;
+            }
+            for (size_t table = 1; table < ret.size(); table++)
+            {
+                for (u32 i = 0; i < 256; i++)
+                {
+                    ret[table][i] = (ret[table - 1][i] << 8) ^ ret[0][ret[table - 1][i] >> 8];
+                }
+            }
+            return ret;
+        }();
+
         u16 crc16(std::span<const u8> buf, u16 initial)
         {
             u16 chk = initial;
@@ -69,22 +93,28 @@ namespace pksm::crypto
 
     u16 ccitt16(std::span<const u8> buf)
     {
-        u16 crc = 0xFFFF;
-        for (u32 i = 0; i < buf.size(); i++)
+        const u8* ptr = buf.data();
+        size_t left   = buf.size();
+        u16 crc       = 0xFFFF;
+
+        // Slice-by-8: fold the running CRC into the first two bytes of each chunk, then look up
+        // every byte's contribution to the CRC eight bytes later in parallel
+        while (left >= 8)
         {
-            crc ^= buf[i] << 8;
-            for (u32 j = 0; j < 0x8; j++)
-            {
-                if ((crc & 0x8000) > 0)
-                {
-                    crc = (crc << 1) ^ 0x1021;
-                }
-                else
-                {
-                    crc <<= 1;
-                }
-            }
+            crc ^= (ptr[0] << 8) | ptr[1];
+            crc = internal::ccitt16_tables[7][crc >> 8] ^ internal::ccitt16_tables[6][crc & 0xFF] ^
+                  internal::ccitt16_tables[5][ptr[2]] ^ internal::ccitt16_tables[4][ptr[3]] ^
+                  internal::ccitt16_tables[3][ptr[4]] ^ internal::ccitt16_tables[2][ptr[5]] ^
+                  internal::ccitt16_tables[1][ptr[6]] ^ internal::ccitt16_tables[0][ptr[7]];
+            ptr  += 8;
+            left -= 8;
         }
+
+        while (left-- > 0)
+        {
+            crc = (crc << 8) ^ internal::ccitt16_tables[0][(crc >> 8) ^ *ptr++];
+        }
+
         return crc;
     }
 
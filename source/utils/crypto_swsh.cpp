@@ -27,6 +27,7 @@
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include <bit>
+#include <cstring>
 
 namespace pksm::crypto::swsh
 {
@@ -60,6 +61,38 @@ namespace pksm::crypto::swsh
 
         // clang-format on
 
+        // The xorpad repeated enough times that any run of XORPAD_CHUNK bytes starting at any
+        // phase of the pad can be read contiguously. XORPAD_CHUNK is a multiple of the pad length,
+        // so the phase is the same at the start of every chunk.
+        constexpr size_t XORPAD_CHUNK = xorpad.size() * 32;
+
+        constexpr std::array<u8, XORPAD_CHUNK + xorpad.size()> expandedXorpad = []
+        {
+            std::array<u8, XORPAD_CHUNK + xorpad.size()> ret{};
+            for (size_t i = 0; i < ret.size(); i++)
+            {
+                ret[i] = xorpad[i % xorpad.size()];
+            }
+            return ret;
+        }();
+
+        void xorBytes(u8* data, const u8* pad, size_t length)
+        {
+            size_t i = 0;
+            for (; i + sizeof(u64) <= length; i += sizeof(u64))
+            {
+                u64 word, padWord;
+                std::memcpy(&word, data + i, sizeof(u64));
+                std::memcpy(&padWord, pad + i, sizeof(u64));
+                word ^= padWord;
+                std::memcpy(data + i, &word, sizeof(u64));
+            }
+            for (; i < length; i++)
+            {
+                data[i] ^= pad[i];
+            }
+        }
+
         std::array<u8, 32> computeHash(u8* data, size_t length)
         {
             SHA256 context;
@@ -111,8 +144,36 @@ namespace pksm::crypto::swsh
 
             u32 next32()
             {
+                if (mCounter == 0)
+                {
+                    u32 ret = mSeed;
+                    advance(mSeed);
+                    return ret;
+                }
                 return next() | (u32(next()) << 8) | (u32(next()) << 16) | (u32(next()) << 24);
             }
+
+            // XORs the next length bytes of the keystream into data, a whole word at a time
+            // wherever possible
+            void apply(u8* data, size_t length)
+            {
+                while (mCounter != 0 && length > 0)
+                {
+                    *data++ ^= next();
+                    length--;
+                }
+
+                for (; length >= sizeof(u32); length -= sizeof(u32), data += sizeof(u32))
+                {
+                    LittleEndian::convertFrom<u32>(data, LittleEndian::convertTo<u32>(data) ^ mSeed);
+                    advance(mSeed);
+                }
+
+                while (length-- > 0)
+                {
+                    *data++ ^= next();
+                }
+            }
         };
 
         class CryptoException : public std::exception
@@ -132,10 +193,21 @@ namespace pksm::crypto::swsh
 
     void applyXor(std::shared_ptr<u8[]> data, size_t length)
     {
-        for (size_t i = 0; i < length - 32; i++)
+        applyXor(std::span{data.get(), length - 32});
+    }
+
+    void applyXor(std::span<u8> data, size_t padOffset)
+    {
+        const u8* pad = internal::expandedXorpad.data() + padOffset % internal::xorpad.size();
+        u8* ptr       = data.data();
+        size_t left   = data.size();
+        while (left >= internal::XORPAD_CHUNK)
         {
-            data[i] ^= internal::xorpad[i % internal::xorpad.size()];
+            internal::xorBytes(ptr, pad, internal::XORPAD_CHUNK);
+            ptr  += internal::XORPAD_CHUNK;
+            left -= internal::XORPAD_CHUNK;
         }
+        internal::xorBytes(ptr, pad, left);
     }
 
     void sign(std::shared_ptr<u8[]> data, size_t length)
@@ -164,153 +236,142 @@ namespace pksm::crypto::swsh
         return true;
     }
 
-    std::vector<std::shared_ptr<SCBlock>> getBlockList(std::shared_ptr<u8[]> data, size_t length)
+    SCBlockList getBlockList(std::shared_ptr<u8[]> data, size_t length, bool lazy)
     {
-        std::vector<std::shared_ptr<SCBlock>> ret;
+        using SCBlockType = SCBlock::SCBlockType;
+
+        SCBlockList ret;
+        ret.data      = data;
         size_t offset = 0;
         while (offset < length - 32)
         {
-            ret.emplace_back(new SCBlock(data, offset));
-        }
-
-        return ret;
-    }
+            size_t start = offset;
+            u32 key      = LittleEndian::convertTo<u32>(data.get() + offset);
+            // Key size
+            offset += 4;
 
-    SCBlock::SCBlock(std::shared_ptr<u8[]> data, size_t& offset) : data(data), myOffset(offset)
-    {
-        // Key size
-        offset += 4;
-
-        internal::XorShift32 xorShift(key());
+            // Only peek at the header here; the block is decrypted in place as a whole afterwards,
+            // or on first use if lazy
+            internal::XorShift32 xorShift(key);
 
-        type = SCBlockType(data[offset] ^= xorShift.next());
+            SCBlockType type    = SCBlockType(data[offset] ^ xorShift.next());
+            SCBlockType subtype = SCBlockType::None;
 
-        switch (type)
-        {
-            case SCBlockType::Bool1:
-            case SCBlockType::Bool2:
-            case SCBlockType::Bool3:
-                // No extra data
-                offset++;
-                break;
-            case SCBlockType::Object:
+            switch (type)
             {
-                dataLength =
-                    LittleEndian::convertTo<u32>(data.get() + offset + 1) ^ xorShift.next32();
-                LittleEndian::convertFrom<u32>(data.get() + offset + 1, dataLength);
-                for (size_t i = 0; i < dataLength; i++)
+                case SCBlockType::Bool1:
+                case SCBlockType::Bool2:
+                case SCBlockType::Bool3:
+                    // No extra data
+                    offset++;
+                    break;
+                case SCBlockType::Object:
                 {
-                    data[offset + 5 + i] ^= xorShift.next();
+                    u32 dataLength =
+                        LittleEndian::convertTo<u32>(data.get() + offset + 1) ^ xorShift.next32();
+                    offset += 5 + dataLength;
                 }
-                offset += 5 + dataLength;
-            }
-            break;
-            case SCBlockType::Array:
-            {
-                dataLength =
-                    LittleEndian::convertTo<u32>(data.get() + offset + 1) ^ xorShift.next32();
-                LittleEndian::convertFrom<u32>(data.get() + offset + 1, dataLength);
-                subtype = SCBlockType(data[offset + 5] ^= xorShift.next());
-                switch (subtype)
+                break;
+                case SCBlockType::Array:
                 {
-                    case SCBlockType::Bool3:
-                        // An array of booleans
-                        for (size_t i = 0; i < dataLength; i++)
-                        {
-                            data[offset + 6 + i] ^= xorShift.next();
-                        }
-                        offset += 6 + dataLength;
-                        break;
-                    case SCBlockType::U8:
-                    case SCBlockType::U16:
-                    case SCBlockType::U32:
-                    case SCBlockType::U64:
-                    case SCBlockType::S8:
-                    case SCBlockType::S16:
-                    case SCBlockType::S32:
-                    case SCBlockType::S64:
-                    case SCBlockType::Float:
-                    case SCBlockType::Double:
+                    u32 dataLength =
+                        LittleEndian::convertTo<u32>(data.get() + offset + 1) ^ xorShift.next32();
+                    subtype = SCBlockType(data[offset + 5] ^ xorShift.next());
+                    switch (subtype)
                     {
-                        size_t entrySize = arrayEntrySize(subtype);
-                        for (size_t i = 0; i < dataLength * entrySize; i++)
-                        {
-                            data[offset + 6 + i] ^= xorShift.next();
-                        }
-                        offset += 6 + (dataLength * entrySize);
+                        case SCBlockType::Bool3:
+                            // An array of booleans
+                            offset += 6 + dataLength;
+                            break;
+                        case SCBlockType::U8:
+                        case SCBlockType::U16:
+                        case SCBlockType::U32:
+                        case SCBlockType::U64:
+                        case SCBlockType::S8:
+                        case SCBlockType::S16:
+                        case SCBlockType::S32:
+                        case SCBlockType::S64:
+                        case SCBlockType::Float:
+                        case SCBlockType::Double:
+                            offset += 6 + (dataLength * SCBlockList::arrayEntrySize(subtype));
+                            break;
+                        default:
+                            throw internal::CryptoException(
+                                "Decoding block: Key: " + std::to_string(key) +
+                                "\nSubtype: " + std::to_string(u8(type)));
                     }
-                    break;
-                    default:
-                        throw internal::CryptoException(
-                            "Decoding block: Key: " + std::to_string(key()) +
-                            "\nSubtype: " + std::to_string(u8(type)));
                 }
+                break;
+                case SCBlockType::U8:
+                case SCBlockType::U16:
+                case SCBlockType::U32:
+                case SCBlockType::U64:
+                case SCBlockType::S8:
+                case SCBlockType::S16:
+                case SCBlockType::S32:
+                case SCBlockType::S64:
+                case SCBlockType::Float:
+                case SCBlockType::Double:
+                    offset += 1 + SCBlockList::arrayEntrySize(type);
+                    break;
+                default:
+                    throw internal::CryptoException("Decoding block: Key: " + std::to_string(key) +
+                                                    "\nType: " + std::to_string(u8(type)));
             }
-            break;
-            case SCBlockType::U8:
-            case SCBlockType::U16:
-            case SCBlockType::U32:
-            case SCBlockType::U64:
-            case SCBlockType::S8:
-            case SCBlockType::S16:
-            case SCBlockType::S32:
-            case SCBlockType::S64:
-            case SCBlockType::Float:
-            case SCBlockType::Double:
+
+            ret.keys.emplace_back(key);
+            ret.offsets.emplace_back(start);
+            ret.sizes.emplace_back(offset - start);
+            ret.types.emplace_back(type);
+            ret.subtypes.emplace_back(subtype);
+            ret.encrypted.emplace_back(1);
+        }
+
+        if (!lazy)
+        {
+            for (size_t i = 0; i < ret.size(); i++)
             {
-                size_t entrySize = arrayEntrySize(type);
-                for (size_t i = 0; i < entrySize; i++)
-                {
-                    data[offset + 1 + i] ^= xorShift.next();
-                }
-                offset += 1 + entrySize;
+                ret[i].decrypt();
             }
-            break;
-            default:
-                throw internal::CryptoException("Decoding block: Key: " + std::to_string(key()) +
-                                                "\nType: " + std::to_string(u8(type)));
         }
+
+        return ret;
     }
 
-    void SCBlock::encrypt()
+    SCBlock SCBlockList::find(u32 key)
     {
-        if (!currentlyEncrypted)
+        // binary search
+        auto found = std::lower_bound(keys.begin(), keys.end(), key);
+        if (found == keys.end() || *found != key)
         {
-            internal::XorShift32 xorShift(key());
-            for (size_t i = 0; i < encryptedDataSize() - 4; i++)
-            {
-                data[myOffset + 4 + i] ^= xorShift.next();
-            }
-
-            currentlyEncrypted = true;
+            return SCBlock{};
         }
+        return SCBlock{this, size_t(found - keys.begin())};
     }
 
-    void SCBlock::decrypt()
+    void SCBlock::encrypt()
     {
-        if (currentlyEncrypted)
+        if (!list->encrypted[index])
         {
             internal::XorShift32 xorShift(key());
-            for (size_t i = 0; i < encryptedDataSize() - 4; i++)
-            {
-                data[myOffset + 4 + i] ^= xorShift.next();
-            }
+            xorShift.apply(list->data.get() + list->offsets[index] + 4, list->sizes[index] - 4);
 
-            currentlyEncrypted = false;
+            list->encrypted[index] = 1;
         }
     }
 
-    u32 SCBlock::key() const
+    void SCBlock::decrypt()
     {
-        return LittleEndian::convertTo<u32>(&data[myOffset]);
-    }
+        if (list->encrypted[index])
+        {
+            internal::XorShift32 xorShift(key());
+            xorShift.apply(list->data.get() + list->offsets[index] + 4, list->sizes[index] - 4);
 
-    void SCBlock::key(u32 v)
-    {
-        LittleEndian::convertFrom<u32>(&data[myOffset], v);
+            list->encrypted[index] = 0;
+        }
     }
 
-    size_t SCBlock::arrayEntrySize(SCBlockType type)
+    size_t SCBlockList::arrayEntrySize(SCBlockType type)
     {
         switch (type)
         {
@@ -334,7 +395,7 @@ namespace pksm::crypto::swsh
         }
     }
 
-    size_t SCBlock::headerSize(SCBlockType type)
+    size_t SCBlockList::headerSize(SCBlockType type)
     {
         switch (type)
         {
@@ -360,35 +421,4 @@ namespace pksm::crypto::swsh
                 throw internal::CryptoException("Type size unknown: " + std::to_string(u32(type)));
         }
     }
-
-    size_t SCBlock::encryptedDataSize()
-    {
-        static constexpr int baseSize = 4 + 1; // key + type
-        switch (type)
-        {
-            case SCBlockType::Bool1:
-            case SCBlockType::Bool2:
-            case SCBlockType::Bool3:
-                return baseSize;
-            case SCBlockType::Object:
-                return baseSize + 4 + dataLength; // + datalength variable + actual data
-            case SCBlockType::Array:
-                return baseSize + 5 +
-                       dataLength *
-                           arrayEntrySize(subtype); // + subtype + datalength variable + actual data
-            case SCBlockType::U8:
-            case SCBlockType::U16:
-            case SCBlockType::U32:
-            case SCBlockType::U64:
-            case SCBlockType::S8:
-            case SCBlockType::S16:
-            case SCBlockType::S32:
-            case SCBlockType::S64:
-            case SCBlockType::Float:
-            case SCBlockType::Double:
-                return baseSize + arrayEntrySize(type); // + actual data
-            default:
-                throw internal::CryptoException("Type size unknown: " + std::to_string(u32(type)));
-        }
-    }
 }